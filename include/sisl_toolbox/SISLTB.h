@@ -1,11 +1,28 @@
 #pragma once
 
+#include "curve_kernel.hpp"
+#include "curve_approximation.hpp"
 #include "curve.hpp"
 #include "straight_line.hpp"
 #include "circular_arc.hpp"
 #include "generic_curve.hpp"
+#include "clothoid.hpp"
+#include "curve_intersection.hpp"
 
+#include "length_index.hpp"
 #include "path.hpp"
+#include "path_view.hpp"
+#include "path_horizon.hpp"
+#include "composite_path.hpp"
+#include "coverage_planner.hpp"
+#include "planar_path.hpp"
+#include "segment_kernel.hpp"
+#include "frame_table.hpp"
+#include "path_profile.hpp"
+#include "trajectory.hpp"
+#include "geometry.hpp"
 #include "path_factory.hpp"
+#include "geodetic_frame.hpp"
 
-#include "persistence_manager.hpp"
\ No newline at end of file
+#include "persistence_manager.hpp"
+#include "polyline_simplifier.hpp"
\ No newline at end of file
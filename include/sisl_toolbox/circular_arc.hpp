@@ -23,6 +23,24 @@ public:
      * @param order Parameter used in Curve constructor -> default = 3
      */
     CircularArc(double angle, Eigen::Vector3d axis, Eigen::Vector3d startPoint, Eigen::Vector3d centrePoint, int dimension = 3, int order = 3);
+
+    /**
+    * @brief Turns the direction of the arc. The rotational angle changes sign, so that the getters still describe the arc.
+    */
+    void Reverse() override;
+
+    std::shared_ptr<Curve> Clone() const override {return CloneAs<CircularArc>();}
+
+    /**
+    * @brief Exact offset of an arc lying on a plane parallel to xy: it is the arc with the same centre and angle and the radius 
+    *        changed by the offset distance. Arcs on other planes fall back to Curve::Offset.
+    *
+    * @param[in] distance Signed offset distance (positive on the left w.r.t. the direction of travel).
+    * @param[in] tolerance Radius below which the offset arc is considered collapsed on its centre.
+    *
+    * @return A shared ptr to the new CircularArc, nullptr if the arc collapses (cusp of the offset path).
+    */
+    std::shared_ptr<Curve> Offset(double distance, double tolerance = 0.001) override;
     
 
     // Getter / Setter methods
@@ -30,6 +48,13 @@ public:
     auto Axis() const& {return axis_;}
     auto CentrePoint() const& {return centrePoint_;}
 
+protected:
+
+    /**
+    * @brief Exact bounding box of the arc: the end points plus the points where a coordinate is extreme on the circle.
+    */
+    void EvalBoundingBox(Eigen::Vector3d& boxMin, Eigen::Vector3d& boxMax) override;
+
 private:
 
     double angle_;
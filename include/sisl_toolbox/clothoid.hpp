@@ -0,0 +1,159 @@
+#pragma once
+
+#include <tuple>
+
+#include "sisl_toolbox/curve.hpp"
+
+/**
+ * @class Clothoid
+ *
+ * @brief Class derived from Curve. It describes a planar Clothoid (Euler spiral), whose curvature varies linearly with the
+ *        arc length. It has no SISL representation: position, derivatives and curvature are evaluated in closed form by means
+ *        of the Fresnel integrals, and the in meters parametrization is the exact arc length.
+ */
+class Clothoid : public Curve {
+
+public:
+
+    /**
+     * @brief Clothoid constructor. The curve lies on the plane z = startPoint[2].
+     *
+     * @param startPoint Start point of the clothoid.
+     * @param startHeading Angle (in rad) of the tangent at the start point w.r.t. the x-axis.
+     * @param startCurvature Signed curvature at the start point (positive when turning counterclockwise).
+     * @param endCurvature Signed curvature at the end point (positive when turning counterclockwise).
+     * @param length Length of the clothoid.
+     *
+     * @param dimension Parameter used in Curve constructor -> default = 3
+     * @param order Parameter used in Curve constructor -> default = 3
+     */
+    Clothoid(Eigen::Vector3d startPoint, double startHeading, double startCurvature, double endCurvature, double length,
+        int dimension = 3, int order = 3);
+
+    void FromAbsSislToPos(double abscissa_s, Eigen::Vector3d& worldF_position) override;
+
+    void FromAbsMetersToPos(double abscissa_m, Eigen::Vector3d& worldF_position) override;
+
+    Eigen::Vector3d At(double abscissa_m) override;
+
+    std::vector<Eigen::Vector3d> Derivate(int order, double abscissa_m) override;
+
+    double Curvature(double abscissa_m) override;
+
+    void Reverse() override;
+
+    std::shared_ptr<Curve> Clone() const override {return CloneAs<Clothoid>();}
+
+    std::shared_ptr<std::vector<Eigen::Vector3d>> Sampling(int const samples) const override;
+
+    std::tuple<double, double> FindClosestPoint(Eigen::Vector3d& worldF_position) override;
+
+    std::tuple<double, double> FindClosestPointOnInterval(Eigen::Vector3d& worldF_position, double startValue_m, 
+        double endValue_m) override;
+
+    std::shared_ptr<Curve> ExtractSection(double startValue_m, double endValue_m) override;
+
+    /**
+    * @brief Offset of the clothoid. The offset of a clothoid is not a clothoid: the exact offset points are interpolated by a 
+    *        cubic B-spline (s1356() SISL routine) with a sampling step chosen according to the tolerance. The part of the 
+    *        clothoid where the offset has a cusp (curvature radius lower than the distance) is trimmed.
+    *
+    * @param[in] distance Signed offset distance (positive on the left w.r.t. the direction of travel).
+    * @param[in] tolerance Geometric tolerance of the approximation of the offset curve.
+    *
+    * @return A shared ptr to the new Curve object, nullptr if the whole offset degenerates.
+    */
+    std::shared_ptr<Curve> Offset(double distance, double tolerance = 0.001) override;
+
+    /**
+    * @brief Eval intersection points between the clothoid and another curve. The clothoid is approximated by chords to find
+    *        the candidate points, which are then refined with a Newton iteration on both curves.
+    * @param[in] otherCurve The other curve w.r.t. evaluate the intersections.
+    *
+    * @return An std::vector<Eigen::Vector3d> containing all the intersection points.
+    */
+    std::vector<Eigen::Vector3d> Intersection(std::shared_ptr<Curve> otherCurve) override;
+
+    void EvalTangentFrame(double abscissa_m, Eigen::Vector3d& tangent, Eigen::Vector3d& normal, Eigen::Vector3d& binormal) override;
+
+    void EvalFSFrame(double abscissa_s, Eigen::Vector3d& tangent, Eigen::Vector3d& normal, Eigen::Vector3d& binormal,
+                            Eigen::Vector3d& der_tan, Eigen::Vector3d& der_nor, Eigen::Vector3d& der_bin) override;
+
+    /**
+     * @brief Angle (in rad) of the tangent w.r.t. the x-axis at a given abscissa.
+     *
+     * @param[in] abscissa_m Abscissa on the curve (in meters).
+     *
+     * @return The heading, not wrapped to any interval.
+     */
+    double Heading(double abscissa_m) const { return startHeading_ + abscissa_m * (startCurvature_ + 0.5 * sharpness_ * abscissa_m); }
+
+    /**
+     * @brief Signed curvature (positive when turning counterclockwise) at a given abscissa.
+     *
+     * @param[in] abscissa_m Abscissa on the curve (in meters).
+     *
+     * @return The signed curvature.
+     */
+    double SignedCurvature(double abscissa_m) const { return startCurvature_ + sharpness_ * abscissa_m; }
+
+    /**
+     * @brief Evaluate the Fresnel integrals C(x) = int_0^x cos(pi/2 t^2) dt and S(x) = int_0^x sin(pi/2 t^2) dt, with a power
+     *        series for |x| <= 1.5 and a continued fraction otherwise.
+     *
+     * @param[in] x Upper limit of the integrals.
+     * @param[out] C Fresnel cosine integral.
+     * @param[out] S Fresnel sine integral.
+     */
+    static void Fresnel(double x, double& C, double& S);
+
+    /**
+     * @brief Geometry of a clothoid transition of given length entering a circular arc of given radius (clothoid starting from a
+     *        straight line with null curvature).
+     *
+     * @param[in] radius Radius of the circular arc reached at the end of the transition.
+     * @param[in] length Length of the transition.
+     *
+     * @return A tuple with: (tangent offset, shift). The tangent offset is the distance, along the straight line, between the
+     *         start of the transition and the projection of the arc centre. The shift is the distance between the straight
+     *         line and the circle of the arc, i.e. the arc centre lies at (radius + shift) from the straight line.
+     */
+    static std::tuple<double, double> TransitionOffsets(double radius, double length);
+
+    /**
+     * @brief Integral of exp(i * (curvature * t + sharpness * t^2 / 2)) over [0, abscissa_m], i.e. the position reached after 
+     *        abscissa_m on a clothoid starting from the origin with null heading.
+     *
+     * @param[in] curvature Signed curvature at the start.
+     * @param[in] sharpness Curvature derivative w.r.t. the arc length.
+     * @param[in] abscissa_m Arc length.
+     * @param[out] x Real part of the integral.
+     * @param[out] y Imaginary part of the integral.
+     */
+    static void Integrate(double curvature, double sharpness, double abscissa_m, double& x, double& y);
+
+    // Getters
+    auto StartHeading() const& {return startHeading_;}
+    auto StartCurvature() const& {return startCurvature_;}
+    auto EndCurvature() const& {return endCurvature_;}
+    auto Sharpness() const& {return sharpness_;}
+
+protected:
+
+    /**
+     * @brief Exact bounding box of the clothoid: the end points plus the points where the heading is a multiple of pi/2.
+     */
+    void EvalBoundingBox(Eigen::Vector3d& boxMin, Eigen::Vector3d& boxMax) override;
+
+private:
+
+    /**
+     * @brief Closed form evaluation of the position at abscissa_m (no range check).
+     */
+    Eigen::Vector3d Position(double abscissa_m) const;
+
+    double startHeading_;
+    double startCurvature_;
+    double endCurvature_;
+    double sharpness_; // Curvature derivative w.r.t. the arc length
+};
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <memory>
+#include <tuple>
+#include <vector>
+#include <eigen3/Eigen/Dense>
+
+#include "sisl_toolbox/length_index.hpp"
+
+class Path;
+
+/**
+ * @class CompositePath
+ *
+ * @brief Concatenation of paths (e.g. survey + transit + return) referenced by shared pointer: a sub-path is appended in
+ *        O(log n) without touching its curves, and the abscissa of the composite path is the sum of the lengths of the
+ *        previous sub-paths (kept in a LengthIndex) plus the abscissa in the sub-path. The lookups go first by sub-path
+ *        (O(log n) on the sub-paths) and then within it (O(log m) on its curves). The sub-paths are shared, not owned:
+ *        after a change of the length of a sub-path, Refresh has to be called to update the offsets.
+ */
+class CompositePath {
+
+public:
+
+    CompositePath() = default;
+
+    /**
+     * @brief Append a sub-path, in O(log n). Throw an exception if the path is null.
+     */
+    void Append(std::shared_ptr<Path> path);
+
+    /**
+     * @brief Append all the sub-paths of another composite path.
+     */
+    void Append(CompositePath const& other);
+
+    /**
+     * @brief Update the offsets after the length of the sub-path partId has changed, in O(log n).
+     */
+    void Refresh(int partId);
+
+    /**
+     * @brief Convert from abscissa of the composite path to abscissa of a sub-path. Throw an exception if the abscissa is
+     *        out of [0, Length()].
+     *
+     * @return A tuple containing respectively: abscissa of the sub-path, sub-path Id.
+     */
+    std::tuple<double, int> PathAbsToPartAbs(double abscissa_m) const;
+
+    /**
+     * @brief Convert from abscissa of the sub-path partId to abscissa of the composite path.
+     */
+    double PartAbsToPathAbs(double abscissaPart_m, int partId) const;
+
+    /**
+     * @brief Given an abscissa return the corresponding point.
+     */
+    Eigen::Vector3d At(double abscissa_m) const;
+
+    /**
+     * @brief Given an abscissa return the derivatives up to the n-th one (see Path::Derivate).
+     */
+    std::vector<Eigen::Vector3d> Derivate(int order, double abscissa_m) const;
+
+    /**
+     * @brief Given an abscissa return the curvature.
+     */
+    double Curvature(double abscissa_m) const;
+
+    /**
+     * @brief Find the closest point among all the sub-paths.
+     *
+     * @param[in] worldF_position Point in the find closest point problem.
+     * @param[out] abscissa_m Abscissa of the closest point on the composite path.
+     *
+     * @return An Eigen::Vector3d representing the closest point.
+     */
+    Eigen::Vector3d FindClosestPoint(Eigen::Vector3d& worldF_position, double& abscissa_m) const;
+
+    /**
+     * @brief Find the abscissa of the closest point on the composite path.
+     */
+    double FindAbscissaClosestPoint(Eigen::Vector3d& worldF_position) const;
+
+    /**
+     * @brief Sampling the composite path: the total points are equally distributed among the sub-paths.
+     */
+    std::shared_ptr<std::vector<Eigen::Vector3d>> Sampling(int samples) const;
+
+    /**
+     * @brief Build a single Path with all the curves of the sub-paths (shared, not copied).
+     */
+    std::shared_ptr<Path> Flatten() const;
+
+    // Getters
+    auto Parts() const& {return parts_;}
+    auto Part(int partId) const& {return parts_[partId];}
+    auto PartsNumber() const& {return static_cast<int>(parts_.size());}
+    auto Length() const& {return partLengths_.Total();}
+
+private:
+
+    std::vector<std::shared_ptr<Path>> parts_;
+    LengthIndex partLengths_;
+};
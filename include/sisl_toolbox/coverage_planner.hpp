@@ -0,0 +1,110 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <set>
+#include <vector>
+#include <eigen3/Eigen/Dense>
+
+class Path;
+class Curve;
+
+/**
+ * @class CoveragePlanner
+ *
+ * @brief Incremental coverage (serpentine) planner over a polygon. The sweep lines lie on a fixed grid (line k at distance
+ *        k * offset from the first one) and the planner keeps, for each of them, its crossings with the polygon edges.
+ *        Each sweep line gives a leg over the span of its crossings, consecutive legs are joined by semicircles of
+ *        diameter offset and a leg is extended to the end of the next one where needed, as in PathFactory::NewSerpentine.
+ *        After a vertex edit only the sweep lines whose span touches the two modified edges are intersected again, and
+ *        only the changed legs and turns are rebuilt and spliced into the Path (see Path::Replace), whose length index and
+ *        segment kernel are updated in place. The path is planar (z = 0) and has no clothoid transitions.
+ */
+class CoveragePlanner {
+
+public:
+
+    /**
+     * @brief CoveragePlanner constructor, building the whole path. Throw an exception if the polygon has less than 3
+     *        vertices, the offset is not positive or no sweep line crosses the polygon.
+     *
+     * @param[in] angle Angle of the sweep lines w.r.t. the x-axis (degrees). The first leg goes along this direction.
+     * @param[in] direction The first turning direction (RIGHT/LEFT), alternating thereafter.
+     * @param[in] offset Distance among the sweep lines, also defining the turn diameter.
+     * @param[in] polygonVerteces The polygon defining the area to be covered.
+     */
+    CoveragePlanner(double angle, int direction, double offset, std::vector<Eigen::Vector3d> const& polygonVerteces);
+
+    /**
+     * @brief Move a vertex of the polygon and update the path. The direction of each leg depends on the parity of its
+     *        sweep line, so the lines added or removed at the ends do not flip the other legs. The legs are compared with
+     *        the previous ones (a few numbers per line) and the curves are built only for the changed ones. Throw an
+     *        exception (leaving the planner unchanged) if vertexId is out of bound or no sweep line crosses the new polygon.
+     *
+     * @param[in] vertexId Id of the vertex.
+     * @param[in] position New position of the vertex (z is ignored).
+     */
+    void MoveVertex(int vertexId, Eigen::Vector3d const& position);
+
+    // Getters
+    auto GetPath() const& {return path_;}
+    auto Verteces() const& {return verteces_;}
+    auto Offset() const& {return offset_;}
+    auto LegsNumber() const& {return static_cast<int>(legs_.size());}
+    auto UpdatedLines() const& {return updatedLines_;}
+    auto RebuiltCurves() const& {return rebuiltCurves_;}
+
+private:
+
+    struct Crossing {
+        int edge;
+        double u;   // Abscissa along the sweep direction
+    };
+
+    struct Leg {
+        int line;
+        double startU;
+        double endU;
+    };
+
+    /**
+     * @brief Remove the crossings of an edge from the sweep lines in its span (remove = true) or add them, collecting the
+     *        lines touched.
+     */
+    void UpdateEdge(int edge, bool remove, std::set<int>& lines);
+
+    /**
+     * @brief Update the crossings of the two edges of a vertex, moved to a new position.
+     */
+    void UpdateVertex(int vertexId, Eigen::Vector3d const& position);
+
+    /**
+     * @brief The legs of the sweep lines crossing the polygon, in order, extended so that the turns are semicircles.
+     */
+    std::vector<Leg> BuildLegs() const;
+
+    /**
+     * @brief Curve curveId of the path described by the legs: the leg curveId / 2 if even, the following turn otherwise.
+     */
+    std::shared_ptr<Curve> BuildCurve(std::vector<Leg> const& legs, int curveId) const;
+
+    /**
+     * @brief Point of the plane in sweep coordinates: u along the sweep direction, v along the normal.
+     */
+    Eigen::Vector3d Point(double u, double v) const;
+
+    double LineOffset(int line) const {return anchor_ + line * step_;}
+
+    std::vector<Eigen::Vector3d> verteces_;
+    std::vector<Eigen::Vector2d> sweepVerteces_;   // Vertices in sweep coordinates (u, v)
+    Eigen::Vector3d lineDirection_;
+    Eigen::Vector3d lineNormal_;
+    double offset_;
+    double anchor_;                                 // Normal coordinate of the sweep line 0
+    double step_;                                   // Normal shift between consecutive lines (+-offset)
+    std::map<int, std::vector<Crossing>> lines_;    // Crossings with the polygon, per sweep line
+    std::vector<Leg> legs_;
+    std::shared_ptr<Path> path_;
+    int updatedLines_;
+    int rebuiltCurves_;
+};
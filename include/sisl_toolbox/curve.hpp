@@ -6,8 +6,11 @@
 
 #include <eigen3/Eigen/Dense>
 
+#include "sisl_toolbox/curve_kernel.hpp"
+
 struct SISLCurve; /** Forward declaration */
 class CurveFactory; /** Forward declaration */
+class CurveApproximation; /** Forward declaration */
 
 /**
  * @class Curve
@@ -15,7 +18,7 @@ class CurveFactory; /** Forward declaration */
  * @brief The main objective of this class is to define a wrapper for the most used SISL functions and to provide an in meters curve parametrization,
  *        internally applying a conversion from meters to Sisl parametrization. 
  */
-class Curve {
+class Curve : public std::enable_shared_from_this<Curve> {
 
 public:
     /** 
@@ -36,6 +39,8 @@ public:
      */ 
     Curve(SISLCurve * curve, int dimension = 3, int order = 3);
 
+    virtual ~Curve() = default;
+
     /**
     * @brief Convert from Sisl parametrization to meters parametrization. If the input abscissa is out of range, an exception is thrown. 
     * @param[in] abscissa_s Starting position (Sisl parametrization) of the point.
@@ -57,14 +62,14 @@ public:
     * @param[in] abscissa_s Abscissa to compute the position.
     * @param[out] worldF_position Used as output parameter to store the position.
     */
-    void FromAbsSislToPos(double abscissa_s, Eigen::Vector3d& worldF_position);
+    virtual void FromAbsSislToPos(double abscissa_s, Eigen::Vector3d& worldF_position);
 
     /**
     * @brief Convert an abscissa value (in meters) to a position in world frame.
     * @param[in] abscissa_m Abscissa to compute the position.
     * @param[out] worldF_position Eigen::Vector3d& containing the position.
     */
-    void FromAbsMetersToPos(double abscissa_m, Eigen::Vector3d& worldF_position);
+    virtual void FromAbsMetersToPos(double abscissa_m, Eigen::Vector3d& worldF_position);
 
     /**
      * @brief Given an abscissa in meters return the corresponding point on the curve.
@@ -73,7 +78,7 @@ public:
      *  
      * @return Eigen::Vector3d containing the point at abscissa_m.
      */
-    Eigen::Vector3d At(double abscissa_m);
+    virtual Eigen::Vector3d At(double abscissa_m);
 
     /**
      * @brief Given an abscissa in meters return the derivatives up to the n-th one at abscissa_m point.
@@ -83,7 +88,7 @@ public:
      *  
      * @return std::vector of Eigen::Vector3d containing the point at abscissa_m.
      */
-    std::vector<Eigen::Vector3d> Derivate(int order, double abscissa_m);
+    virtual std::vector<Eigen::Vector3d> Derivate(int order, double abscissa_m);
 
     /**
      * @brief Evaluate the curvature of the curve at a given parameter value.
@@ -92,12 +97,18 @@ public:
      * 
      * @return Curvature value.
      */ 
-    double Curvature(double abscissa_m);
+    virtual double Curvature(double abscissa_m);
     
     /**
     * @brief Turns the direction of the orginal curve.
     */
-    void Reverse();
+    virtual void Reverse();
+
+    /**
+    * @brief Deep copy of the curve (the SISL curve is copied too), e.g. to change a curve shared among paths without 
+    *        affecting the others.
+    */
+    virtual std::shared_ptr<Curve> Clone() const {return CloneAs<Curve>();}
 
     /**
     * @brief Samples the curve. 
@@ -105,7 +116,7 @@ public:
     * 
     * @return A <std::vector<Eigen::Vector3d>> containing the points.
     */
-    std::shared_ptr<std::vector<Eigen::Vector3d>> Sampling(int const samples) const;
+    virtual std::shared_ptr<std::vector<Eigen::Vector3d>> Sampling(int const samples) const;
 
     /**
     * @brief Find the closest point between a curve and a point.
@@ -116,7 +127,22 @@ public:
     * the closest point problem. The second element is the distance between the point passed as argument (worldF_position) 
     * and the point on curve solution of the closest point problem.
     */
-    std::tuple<double, double> FindClosestPoint(Eigen::Vector3d& worldF_position);
+    virtual std::tuple<double, double> FindClosestPoint(Eigen::Vector3d& worldF_position);
+
+    /**
+    * @brief Find the closest point between a portion of the curve and a point, without extracting the portion. The global 
+    * solution is kept when it lies in the portion, otherwise the best of a coarse sampling of the portion is refined by 
+    * the s1774() SISL routine bounded to it.
+    * 
+    * @param[in] worldF_position The point in the closest point problem.
+    * @param[in] startValue_m Start abscissa (in meters) of the portion.
+    * @param[in] endValue_m End abscissa (in meters) of the portion.
+    * 
+    * @return A tuple (double, double) containing the abscissa_m (in meters) of the closest point on the portion and its 
+    * distance from worldF_position.
+    */
+    virtual std::tuple<double, double> FindClosestPointOnInterval(Eigen::Vector3d& worldF_position, double startValue_m, 
+        double endValue_m);
 
     /**
     * @brief Pick a part of a curve. It extracts a new curve from the stating one according to the abscissa startValue and endValue.
@@ -126,7 +152,30 @@ public:
     * 
     * @return A shared ptr to the new Curve object.
     */
-    std::shared_ptr<Curve> ExtractSection(double startValue_m, double endValue_m);
+    virtual std::shared_ptr<Curve> ExtractSection(double startValue_m, double endValue_m);
+
+    /**
+    * @brief Compute the offset (parallel) curve based on s1360() SISL routine. A positive distance moves the curve on the left
+    *        w.r.t. the direction of travel, i.e. along the normal computed by EvalTangentFrame.
+    *
+    * @param[in] distance Signed offset distance.
+    * @param[in] tolerance Geometric tolerance of the approximation of the offset curve.
+    *
+    * @return A shared ptr to the new Curve object, nullptr if the offset degenerates (e.g. an arc collapsing on its centre).
+    */
+    virtual std::shared_ptr<Curve> Offset(double distance, double tolerance = 0.001);
+
+    /**
+    * @brief Join the end of this curve with the start of another one in a single spline, based on s1715() SISL routine. The 
+    *        in meters parametrization of the result is the linear scaling of the SISL one, as for any generic curve.
+    *
+    * @param[in] otherCurve The curve to be appended.
+    * @param[in] tolerance Maximum distance between the end of this curve and the start of the other one.
+    *
+    * @return A shared ptr to the joined Curve, nullptr if the curves cannot be joined (too far apart or without a SISL 
+    *         representation).
+    */
+    std::shared_ptr<Curve> Join(std::shared_ptr<Curve> otherCurve, double tolerance = 0.001);
 
     /**
     * @brief Eval intersection points between two curves.
@@ -147,7 +196,7 @@ public:
     * 
     * @return An std::vector<Eigen::Vector3d> containing all the intersection points.
     */
-    std::vector<Eigen::Vector3d> Intersection(std::shared_ptr<Curve> otherCurve);
+    virtual std::vector<Eigen::Vector3d> Intersection(std::shared_ptr<Curve> otherCurve);
 
 
 
@@ -160,7 +209,7 @@ public:
     * @param[out] normal Normal component of the tangent 3D frame.
     * @param[out] binormal Binormal component of the tangent 3D frame.
     */
-    void EvalTangentFrame(double abscissa_m, Eigen::Vector3d& tangent, Eigen::Vector3d& normal, Eigen::Vector3d& binormal);
+    virtual void EvalTangentFrame(double abscissa_m, Eigen::Vector3d& tangent, Eigen::Vector3d& normal, Eigen::Vector3d& binormal);
 
     /**
     * @brief Compute the Frenet–Serret frame from the abscissa value.
@@ -170,10 +219,45 @@ public:
     * @param[out] binormal Binormal component of the tangent 3D frame.
     * @param[out] Derivative of position,tanget,normal,binormal.
     */
-    void EvalFSFrame(double abscissa_s, Eigen::Vector3d& tangent, Eigen::Vector3d& normal, Eigen::Vector3d& binormal,
+    virtual void EvalFSFrame(double abscissa_s, Eigen::Vector3d& tangent, Eigen::Vector3d& normal, Eigen::Vector3d& binormal,
                             Eigen::Vector3d& der_tan, Eigen::Vector3d& der_nor, Eigen::Vector3d& der_bin);
 
 
+    /**
+    * @brief Enable the piecewise polynomial approximation of the curve (see CurveApproximation), used by At, 
+    *        FromAbsMetersToPos (hence Path::At and Path::FindClosestPoint), Derivate (up to the second derivative) and 
+    *        Curvature instead of the SISL evaluation. It is built at the first query and rebuilt 
+    *        whenever the curve changes.
+    *
+    * @param[in] tolerance Target error of the approximation on the position, divided by the piece width (and by its 
+    *            square) on the first (second) derivative, estimated at the check points of each piece (see 
+    *            CurveApproximation::Converged).
+    */
+    void EnableApproximation(double tolerance = 1e-6);
+
+    /**
+    * @brief Disable the piecewise polynomial approximation and release it.
+    */
+    void DisableApproximation();
+
+    /**
+    * @brief The piecewise polynomial approximation of the curve, built if needed. It also converts the meter parametrization 
+    *        into the true arc length and back (CurveApproximation::ArcLength and CurveApproximation::MeterAbs).
+    *
+    * @return A shared ptr to the approximation, nullptr if it is not enabled or if the curve has no SISL representation.
+    */
+    std::shared_ptr<CurveApproximation const> Approximation();
+
+    /**
+    * @brief Check if the bounding boxes of two curves overlap (broad phase of the intersection problems).
+    *
+    * @param[in] otherCurve The other curve.
+    * @param[in] tolerance Distance added to the boxes.
+    *
+    * @return False if the curves cannot intersect.
+    */
+    bool BoxesOverlap(Curve const& otherCurve, double tolerance = 0) const;
+
     friend std::ostream& operator<< (std::ostream& os, const Curve& obj) {
         return os 
             << "Curve name: " << obj.name_
@@ -197,18 +281,77 @@ public:
     auto StartPoint() const& {return startPoint_;}
     auto EndPoint() const& {return endPoint_;}
     auto Name() const& {return name_;}
+    static constexpr auto MergeDistance() {return mergeDistance_;}
+    // End point data cached at construction (see CacheEndpointData)
+    auto BoxMin() const& {return boxMin_;}
+    auto BoxMax() const& {return boxMax_;}
+    auto StartTangent() const& {return startTangent_;}
+    auto EndTangent() const& {return endTangent_;}
+    auto StartPointCurvature() const& {return startPointCurvature_;}
+    auto EndPointCurvature() const& {return endPointCurvature_;}
 
 
 private:
 
     friend class CurveFactory;
 
+    static constexpr double mergeDistance_{1e-5}; // Intersection points closer than this are the same point
+
     int dimension_; // Dimension of the curve
     int order_; // Order of the curve
     double epsge_; // Geometric resolution
 
 protected:
+
+    /**
+    * @brief Build the piecewise polynomial approximation if it is enabled and not built yet.
+    *
+    * @return True if approximation_ can be used.
+    */
+    bool UseApproximation();
+
+    /**
+    * @brief Copy of the derived curve T with its own SISL curve (the implicit copy constructor shares curve_).
+    */
+    template <typename T>
+    std::shared_ptr<Curve> CloneAs() const {
+        auto clone = std::make_shared<T>(static_cast<T const&>(*this));
+        clone->CopySislCurve();
+        return clone;
+    }
+
+    /**
+    * @brief Replace curve_ with a copy of it (see CloneAs).
+    */
+    void CopySislCurve();
+
+    /**
+    * @brief Select the evaluation kernel of curve_ (see CurveKernelInterface::Select). It must be called whenever curve_ is 
+    *        built, the evaluation methods go through the selected kernel. The approximation of the previous curve_ is dropped.
+    */
+    void BindKernel() { 
+        kernel_ = &CurveKernelInterface::Select(curve_);
+        approximation_.reset();
+    }
+
+    /**
+    * @brief Cache the bounding box, the unit tangents and the curvatures at the end points. It must be called whenever the 
+    *        curve is built or changed (e.g. Reverse), once the parametrization and the end points are set.
+    */
+    void CacheEndpointData();
+
+    /**
+    * @brief Axis aligned bounding box of the curve: the box of the control polygon of curve_, which contains the curve.
+    *
+    * @param[out] boxMin Minimum corner.
+    * @param[out] boxMax Maximum corner.
+    */
+    virtual void EvalBoundingBox(Eigen::Vector3d& boxMin, Eigen::Vector3d& boxMax);
+
     SISLCurve *curve_;
+    CurveKernelInterface const* kernel_; // Evaluation kernel of curve_
+    std::shared_ptr<CurveApproximation> approximation_; // Built lazily when approximationTolerance_ is positive
+    double approximationTolerance_; // Null when the approximation is disabled
     int statusFlag_; // Control flag used as output of each SISL function
 
     std::string name_;
@@ -219,6 +362,12 @@ protected:
     double endParameter_m_;  
     Eigen::Vector3d startPoint_; // Curve start point
     Eigen::Vector3d endPoint_; // Curve end point
+    Eigen::Vector3d boxMin_; // Bounding box minimum corner
+    Eigen::Vector3d boxMax_; // Bounding box maximum corner
+    Eigen::Vector3d startTangent_; // Unit tangent at the start point
+    Eigen::Vector3d endTangent_; // Unit tangent at the end point
+    double startPointCurvature_; // Curvature at the start point
+    double endPointCurvature_; // Curvature at the end point
 
 };
 
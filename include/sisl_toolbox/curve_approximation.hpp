@@ -0,0 +1,121 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+#include <eigen3/Eigen/Dense>
+
+/**
+ * @class CurveApproximation
+ *
+ * @brief Piecewise polynomial approximation of a curve in the meter parametrization. Each piece is the quintic Hermite
+ *        interpolant of the position, the first and the second derivatives at its ends, so the approximation is C2 and its
+ *        evaluation is a Horner scheme (a few FMAs) after a binary search on the breakpoints. The pieces are bisected until
+ *        the position, the first and the second derivatives are within the tolerance at the check points of each piece
+ *        (the quarters and the middle): the error is estimated there, not bounded on the whole piece. The derivatives have
+ *        other units than the position, so their tolerance is scaled by the width h of the piece: tolerance on the
+ *        position, tolerance / h on the first derivative and tolerance / h^2 on the second one (their effect on the
+ *        position over the piece). A piece still above the tolerance after the maximum number of bisections is kept and
+ *        the approximation is flagged as not converged (see Converged and MaxError). The arc length of each piece is
+ *        integrated (Gauss-Legendre) on the approximation, providing the conversion among the meter parametrization (a
+ *        linear scaling of the SISL one) and the true arc length.
+ */
+class CurveApproximation {
+
+public:
+
+    /**
+     * @brief Exact evaluation used to build the approximation.
+     *
+     * @param[in] abscissa_m Abscissa (meter parametrization).
+     * @param[in] fromLeft If true, the left limit of the derivatives at the abscissa (used at the end of the breakpoint
+     *            intervals, where the derivatives of the curve may jump).
+     * @param[out] derivatives Position, first and second derivatives w.r.t. the meter parametrization.
+     */
+    using Evaluator = std::function<void(double abscissa_m, bool fromLeft, std::vector<Eigen::Vector3d>& derivatives)>;
+
+    /**
+     * @brief Build the approximation.
+     *
+     * @param[in] evaluator Exact evaluation of the curve.
+     * @param[in] breakpoints_m Sorted abscissae (meter parametrization) that must be breakpoints of the approximation: at
+     *            least the start and the end of the curve, plus the knots where the curve is not smooth.
+     * @param[in] tolerance Target error on the position at the check points, divided by h and h^2 (h the width of the
+     *            piece) on the first and the second derivatives.
+     */
+    CurveApproximation(Evaluator const& evaluator, std::vector<double> const& breakpoints_m, double tolerance);
+
+    /**
+     * @brief Position at the given abscissa (meter parametrization), clamped to the approximated interval.
+     */
+    Eigen::Vector3d At(double abscissa_m) const;
+
+    /**
+     * @brief Position and derivatives at the given abscissa (meter parametrization), clamped to the approximated interval.
+     *
+     * @param[in] order Evaluate the derivatives from 1 up to order (at most 2, the higher ones are not approximated).
+     * @param[in] abscissa_m Abscissa (meter parametrization).
+     * @param[out] derivatives Resized to order + 1: the position followed by the derivatives w.r.t. the meter parametrization.
+     */
+    void Derivatives(int order, double abscissa_m, std::vector<Eigen::Vector3d>& derivatives) const;
+
+    /**
+     * @brief Curvature at the given abscissa (meter parametrization).
+     */
+    double Curvature(double abscissa_m) const;
+
+    /**
+     * @brief Arc length from the start of the curve to the given abscissa (meter parametrization).
+     */
+    double ArcLength(double abscissa_m) const;
+
+    /**
+     * @brief Abscissa (meter parametrization) reached after the given arc length from the start of the curve (inverse of
+     *        ArcLength), clamped to the approximated interval.
+     */
+    double MeterAbs(double arcLength_m) const;
+
+    // Getters
+    auto PiecesNumber() const& {return static_cast<int>(coefficients_.size());}
+    auto Tolerance() const& {return tolerance_;}
+    auto MaxError() const& {return maxError_;}
+    auto Converged() const& {return maxError_ <= tolerance_;}
+    auto TotalArcLength() const& {return arcLengths_.back();}
+
+private:
+
+    using Coefficients = Eigen::Matrix<double, 3, 6>; // Monomial coefficients w.r.t. the offset from the piece start
+
+    /**
+     * @brief Recursively bisect [startAbscissa_m, endAbscissa_m] until the quintic Hermite interpolant fits the curve.
+     */
+    void Refine(Evaluator const& evaluator, double startAbscissa_m, std::vector<Eigen::Vector3d> const& start,
+        double endAbscissa_m, std::vector<Eigen::Vector3d> const& end, int depth);
+
+    /**
+     * @brief Quintic Hermite interpolant of the end data of a piece of the given width.
+     */
+    static Coefficients Interpolate(std::vector<Eigen::Vector3d> const& start, std::vector<Eigen::Vector3d> const& end, double width);
+
+    /**
+     * @brief Position, first and second derivatives (up to order) of a piece at the offset u from its start (Horner scheme).
+     */
+    static void EvaluatePiece(Coefficients const& c, double u, int order, std::vector<Eigen::Vector3d>& derivatives);
+
+    /**
+     * @brief Piece containing the abscissa and the offset of the abscissa from the piece start.
+     */
+    int FindPiece(double abscissa_m, double& offset_m) const;
+
+    /**
+     * @brief Arc length of a piece from its start to the given offset.
+     */
+    double PieceArcLength(int piece, double offset_m) const;
+
+    static constexpr int maxDepth_{24}; // Maximum number of bisections of a breakpoint interval
+
+    std::vector<double> breakpoints_m_; // Start of each piece, plus the end of the last one
+    std::vector<Coefficients, Eigen::aligned_allocator<Coefficients>> coefficients_;
+    std::vector<double> arcLengths_; // Arc length at each breakpoint
+    double tolerance_;
+    double maxError_{0}; // Maximum error estimated at the check points, derivatives scaled (above the tolerance if not converged)
+};
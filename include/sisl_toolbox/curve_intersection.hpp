@@ -0,0 +1,89 @@
+#pragma once
+
+#include <vector>
+#include <eigen3/Eigen/Dense>
+
+class Curve;
+class StraightLine;
+class CircularArc;
+
+/**
+ * @class CurveIntersection
+ *
+ * @brief Closed form intersections among straight lines and circular arcs lying on the same plane parallel to xy (as the
+ *        curves built by the PathFactory). Curve::Intersection dispatches the pairs of analytic curves here and uses the
+ *        SISL subdivision (s1857) only for the other curves. Tolerance policy: the crossing of two lines is decided by the
+ *        exact predicates of Geometry, the other intersections (and the near misses of the lines) found up to tolerance
+ *        beyond the end of a curve are clamped on it, tangent contacts (chord shorter than tolerance) give a single point,
+ *        overlapping collinear lines and co-circular arcs give no point (as the intersection curves of s1857) unless they
+ *        only touch at their ends.
+ */
+class CurveIntersection {
+
+public:
+
+    /**
+     * @brief Intersection point and its abscissae on the two curves.
+     */
+    struct Point {
+        Eigen::Vector3d position;
+        double firstArcLength;  // Arc length from the start of the first curve (the meter abscissa for straight lines)
+        double secondArcLength; // Arc length from the start of the second curve
+    };
+
+    /**
+     * @brief Intersections among two curves in closed form.
+     *
+     * @param[in] first First curve.
+     * @param[in] second Second curve.
+     * @param[in] tolerance Geometric tolerance.
+     * @param[out] points The intersection points.
+     *
+     * @return False if the pair is not supported (not straight lines or circular arcs, or not on the same plane parallel
+     *         to xy): points is left untouched and the caller has to solve the problem otherwise.
+     */
+    static bool Evaluate(Curve const& first, Curve const& second, double tolerance, std::vector<Point>& points);
+
+private:
+
+    /**
+     * @brief Planar description of a straight line or of a circular arc.
+     */
+    struct Primitive {
+        bool isArc;
+        Eigen::Vector2d startPoint;
+        Eigen::Vector2d endPoint;  // Line
+        Eigen::Vector2d direction; // Line: end point - start point
+        Eigen::Vector2d centre;    // Arc
+        double radius;             // Arc
+        double startAngle;         // Arc: angle of the start point w.r.t. the centre
+        double sense;              // Arc: +1 counterclockwise, -1 clockwise
+        double length;             // Arc length
+    };
+
+    /**
+     * @brief Build the planar description of a curve.
+     *
+     * @return False if the curve is not a straight line or an arc on a plane parallel to xy.
+     */
+    static bool MakePrimitive(Curve const& curve, double tolerance, Primitive& primitive);
+
+    /**
+     * @brief Arc length of a point of the circle of an arc, -1 if it is out of the arc (beyond tolerance).
+     */
+    static double ArcLength(Primitive const& arc, Eigen::Vector2d const& point, double tolerance);
+
+    /**
+     * @brief Arc length of a point of a line, given its parameter in [0, 1] on direction, -1 if it is out of the line.
+     */
+    static double LineLength(Primitive const& line, double parameter, double tolerance);
+
+    static void LineLine(Primitive const& first, Primitive const& second, double tolerance,
+        std::vector<Eigen::Vector2d>& points, std::vector<double>& firstLengths, std::vector<double>& secondLengths);
+
+    static void LineArc(Primitive const& line, Primitive const& arc, double tolerance,
+        std::vector<Eigen::Vector2d>& points, std::vector<double>& lineLengths, std::vector<double>& arcLengths);
+
+    static void ArcArc(Primitive const& first, Primitive const& second, double tolerance,
+        std::vector<Eigen::Vector2d>& points, std::vector<double>& firstLengths, std::vector<double>& secondLengths);
+};
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <vector>
+#include <eigen3/Eigen/Dense>
+
+struct SISLCurve; /** Forward declaration */
+
+/**
+ * @class CurveKernelInterface
+ *
+ * @brief Evaluation kernel of a SISL curve (position and derivatives w.r.t. the SISL parametrization). Each Curve selects its
+ *        kernel once, when its SISL curve is built, according to the dimension and the order of the B-spline. The output is
+ *        always 3D: the missing coordinates of a planar curve are set to zero.
+ */
+class CurveKernelInterface {
+
+public:
+
+    virtual ~CurveKernelInterface() = default;
+
+    /**
+     * @brief Position at the given SISL parameter.
+     *
+     * @param[in] curve SISL curve to be evaluated.
+     * @param[in] abscissa_s Abscissa (SISL parametrization).
+     * @param[out] worldF_position The position.
+     */
+    virtual void Position(SISLCurve const* curve, double abscissa_s, Eigen::Vector3d& worldF_position) const = 0;
+
+    /**
+     * @brief Position and derivatives at the given SISL parameter.
+     *
+     * @param[in] curve SISL curve to be evaluated.
+     * @param[in] order Evaluate the derivatives from 1 up to order.
+     * @param[in] abscissa_s Abscissa (SISL parametrization).
+     * @param[out] derivatives Resized to order + 1: the position followed by the derivatives.
+     */
+    virtual void Derivatives(SISLCurve const* curve, int order, double abscissa_s, std::vector<Eigen::Vector3d>& derivatives) const = 0;
+
+    /**
+     * @brief Select the kernel for a SISL curve: one of the CurveKernel specializations if the pair (dimension, order) is
+     *        compiled in, the SislCurveKernel otherwise.
+     *
+     * @param[in] curve SISL curve, can be nullptr.
+     *
+     * @return A reference to a stateless kernel shared by all the curves.
+     */
+    static CurveKernelInterface const& Select(SISLCurve const* curve);
+};
+
+
+/**
+ * @class CurveKernel
+ *
+ * @brief Native evaluation (de Boor, The NURBS Book A2.3 and A4.2) with the dimension and the order of the B-spline known at
+ *        compile time: fixed size Eigen types and loops unrolled by the compiler. Both polynomial and rational curves are
+ *        handled. Instantiated for (2, 2), (3, 2), (3, 3) and (3, 4).
+ */
+template <int Dim, int Order>
+class CurveKernel : public CurveKernelInterface {
+
+public:
+
+    void Position(SISLCurve const* curve, double abscissa_s, Eigen::Vector3d& worldF_position) const override;
+
+    void Derivatives(SISLCurve const* curve, int order, double abscissa_s, std::vector<Eigen::Vector3d>& derivatives) const override;
+
+private:
+
+    static constexpr int degree_{Order - 1};
+
+    /**
+     * @brief Knot span containing the parameter, the last non empty span for the end of the parametrization.
+     */
+    static int FindSpan(SISLCurve const* curve, double abscissa_s);
+
+    /**
+     * @brief Homogeneous (weight as last coordinate, 1 for polynomial curves) control point of the curve.
+     */
+    static Eigen::Matrix<double, Dim + 1, 1> ControlPoint(SISLCurve const* curve, int index);
+};
+
+
+/**
+ * @class SislCurveKernel
+ *
+ * @brief Fallback kernel for any dimension and order, going through the s1221() SISL routine.
+ */
+class SislCurveKernel : public CurveKernelInterface {
+
+public:
+
+    void Position(SISLCurve const* curve, double abscissa_s, Eigen::Vector3d& worldF_position) const override;
+
+    void Derivatives(SISLCurve const* curve, int order, double abscissa_s, std::vector<Eigen::Vector3d>& derivatives) const override;
+};
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <eigen3/Eigen/Dense>
+
+class Path;
+
+/**
+ * @class FrameTable
+ *
+ * @brief Table of rotation minimising frames precomputed along a Path (double reflection method). The frames are sampled on a
+ *        uniform abscissa grid and stored as quaternions, so that a frame query is a table lookup plus a slerp instead of 
+ *        several SISL evaluations. The initial normal is the one of Path::EvalTangentFrame (tangent x -z); along the path the 
+ *        normal does not twist around the tangent, which gives smooth frames also for 3D paths.
+ */
+class FrameTable {
+
+public:
+
+    /**
+     * @brief FrameTable constructor. Throw an exception if the path is empty or the step is not positive.
+     *
+     * @param[in] path Path along which the frames are computed.
+     * @param[in] step Abscissa step (in meters) of the table. The last interval is shortened to end on the path end.
+     */
+    FrameTable(std::shared_ptr<Path> path, double step);
+
+    /**
+    * @brief Eval the rotation minimising frame at the abscissa, interpolating the table.
+    * 
+    * @param[in] abscissa_m Path abscissa where to calculate the frame.
+    * @param[out] tangent Tangent component of the 3D frame.
+    * @param[out] normal Normal component of the 3D frame.
+    * @param[out] binormal Binormal component of the 3D frame.
+    */
+    void EvalTangentFrame(double abscissa_m, Eigen::Vector3d& tangent, Eigen::Vector3d& normal, Eigen::Vector3d& binormal) const;
+
+    /**
+    * @brief Eval the rotation minimising frame at the abscissa, interpolating the table.
+    * 
+    * @param[in] abscissa_m Path abscissa where to calculate the frame.
+    *
+    * @return The frame as a quaternion: its orientation in the world frame, i.e. the rotation whose matrix has the
+    *         tangent, normal and binormal (in world coordinates) as columns.
+    */
+    Eigen::Quaterniond Eval(double abscissa_m) const;
+
+    // Getters
+    auto Step() const& {return step_;}
+    auto StartParameter() const& {return startParameter_m_;}
+    auto EndParameter() const& {return endParameter_m_;}
+    auto SamplesNumber() const& {return frames_.size();}
+
+private:
+
+    double step_;
+    double startParameter_m_;
+    double endParameter_m_;
+    std::vector<Eigen::Quaterniond> frames_;
+};
@@ -29,17 +29,87 @@ public:
     GenericCurve(int degree, std::vector<double> knots, std::vector<Eigen::Vector3d> points, std::vector<double> weights, 
         std::vector<double> coefficients, int dimension = 3, int order = 3);
 
+    /** 
+     * @brief GenericCurve constructor fitting a dense sequence of points (e.g. a recorded track) with a least squares B-spline.
+     *        The samples are parametrized by chord length, the end points are interpolated and the knots are inserted where 
+     *        the approximation error is above the tolerance, halving the spans until the tolerance is met. Each iteration 
+     *        solves the banded normal equations natively, so the cost is linear in the number of samples.
+     * 
+     * @param samples The points to be approximated, at least degree + 1.
+     * @param tolerance Maximum distance between the samples and the curve.
+     * @param degree Degree of the B-spline -> default = 3
+     * @param maxControlPoints Upper bound to the number of control points, not bounded if 0 -> default = 0
+     * 
+     * @param dimension Parameter used in Curve constructor -> default = 3
+     * @param order Parameter used in Curve constructor -> default = 3
+     */ 
+    GenericCurve(std::vector<Eigen::Vector3d> const& samples, double tolerance, int degree = 3, int maxControlPoints = 0, 
+        int dimension = 3, int order = 3);
+
+    /** 
+     * @brief Evaluate the curve at many abscissae natively, without going through s1221() one parameter at a time. The knot 
+     *        spans of a sorted abscissae array are located in a single merge pass (a binary search is used where the order 
+     *        breaks), the basis functions are evaluated for blocks of parameters in SIMD lanes and the homogeneous divide of 
+     *        the rational curve is vectorised as well.
+     * 
+     * @param[in] abscissae_m Abscissae on the curve (in meters), preferably sorted.
+     *  
+     * @return std::vector<Eigen::Vector3d> containing the points, in the same order of the abscissae.
+     */
+    std::vector<Eigen::Vector3d> BatchAt(std::vector<double> const& abscissae_m) const;
+
+    /** 
+     * @brief Sampling through the native batch evaluator, with the same (uniform in the SISL parametrization) samples of 
+     *        Curve::Sampling().
+     */
+    std::shared_ptr<std::vector<Eigen::Vector3d>> Sampling(int const samples) const override;
+
+    /** 
+     * @brief Reverse the curve, keeping knots, control points, weights and coefficients consistent with the SISL curve.
+     */
+    void Reverse() override;
+
+    std::shared_ptr<Curve> Clone() const override {return CloneAs<GenericCurve>();}
+
     // Getters
     auto Degree() const& {return degree_;}
     auto Knots() const& {return knots_;}
     auto Points() const& {return points_;}
     auto Weights() const& {return weights_;}
     auto Coefficients() const& {return coefficients_;}
+    auto FittingError() const& {return fittingError_;}
 
 private:
+
+    /**
+     * @brief Build the SISL curve from knots_ and coefficients_ (newCurve() SISL routine) and initialize the parametrizations.
+     */
+    void BuildSislCurve();
+
+    /**
+     * @brief Least squares control points for the given knots, with the first and last control points fixed on the first and 
+     *        last samples. A small second difference penalty keeps the system regular on the spans without samples.
+     */
+    static std::vector<Eigen::Vector3d> FitControlPoints(std::vector<Eigen::Vector3d> const& samples, 
+        std::vector<double> const& parameters, std::vector<double> const& knots, int degree);
+
+    /**
+     * @brief Non vanishing B-spline basis functions at parameter in the knot span (The NURBS Book, A2.2).
+     */
+    static void BasisFunctions(int span, double parameter, int degree, std::vector<double> const& knots, double* basis);
+
+    /**
+     * @brief Evaluate the curve at the given SISL parameters, in blocks of batchLanes_ parameters.
+     */
+    void EvaluateSisl(std::vector<double> const& abscissae_s, std::vector<Eigen::Vector3d>& points) const;
+
+    static constexpr int maxDegree_{9};
+    static constexpr int batchLanes_{8};
+
     int degree_;
     std::vector<double> knots_;
     std::vector<Eigen::Vector3d> points_;
     std::vector<double> weights_;
     std::vector<double> coefficients_;
-};
\ No newline at end of file
+    double fittingError_{0};
+};
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <cmath>
+#include <memory>
+#include <vector>
+#include <eigen3/Eigen/Dense>
+
+/**
+ * @class GeodeticFrame
+ *
+ * @brief Local East-North-Up (ENU) frame bound to a WGS84 reference origin. It converts geodetic coordinates 
+ *        (latitude [deg], longitude [deg], altitude [m]), stored in Eigen::Vector3d, to local metres and back, so that the 
+ *        paths can be built in the ENU frame. The batch conversions work on structure of arrays loops without trigonometric 
+ *        calls: near the origin (angular offsets below smallAngle_) the sine, cosine and arctangent of the offsets are 
+ *        polynomials and the latitude is found with a fixed number of square root iterations, so that the compiler can 
+ *        vectorize the loops. The points 
+ *        farther away (or a reference origin too close to the poles) fall back to the exact scalar conversion.
+ */
+class GeodeticFrame {
+
+public:
+
+    /**
+     * @brief GeodeticFrame constructor.
+     *
+     * @param[in] origin Reference origin (latitude [deg], longitude [deg], altitude [m]).
+     */
+    GeodeticFrame(Eigen::Vector3d const& origin);
+
+    /**
+     * @brief Convert a geodetic point to the local ENU frame (exact scalar conversion).
+     * 
+     * @param[in] geodeticPoint Point as (latitude [deg], longitude [deg], altitude [m]).
+     *  
+     * @return The point in the ENU frame (east, north, up) [m].
+     */
+    Eigen::Vector3d ToENU(Eigen::Vector3d const& geodeticPoint) const;
+
+    /**
+     * @brief Convert a point of the local ENU frame to geodetic coordinates (exact scalar conversion).
+     * 
+     * @param[in] enuPoint Point in the ENU frame (east, north, up) [m].
+     *  
+     * @return The point as (latitude [deg], longitude [deg], altitude [m]).
+     */
+    Eigen::Vector3d ToGeodetic(Eigen::Vector3d const& enuPoint) const;
+
+    /**
+     * @brief Batch conversion of geodetic points (e.g. the vertices of a polygon) to the local ENU frame.
+     * 
+     * @param[in] geodeticPoints Points as (latitude [deg], longitude [deg], altitude [m]).
+     *  
+     * @return The points in the ENU frame (east, north, up) [m].
+     */
+    std::vector<Eigen::Vector3d> ToENU(std::vector<Eigen::Vector3d> const& geodeticPoints) const;
+
+    /**
+     * @brief Batch conversion of points of the local ENU frame to geodetic coordinates.
+     * 
+     * @param[in] enuPoints Points in the ENU frame (east, north, up) [m].
+     *  
+     * @return The points as (latitude [deg], longitude [deg], altitude [m]).
+     */
+    std::vector<Eigen::Vector3d> ToGeodetic(std::vector<Eigen::Vector3d> const& enuPoints) const;
+
+    /**
+     * @brief Batch conversion of a sampled buffer (e.g. given by Path::Sampling) to geodetic coordinates.
+     * 
+     * @param[in] enuPoints Shared ptr of vector of points in the ENU frame (east, north, up) [m].
+     *  
+     * @return Shared ptr of vector of points as (latitude [deg], longitude [deg], altitude [m]).
+     */
+    std::shared_ptr<std::vector<Eigen::Vector3d>> ToGeodetic(std::shared_ptr<std::vector<Eigen::Vector3d>> enuPoints) const;
+
+    // Getters
+    auto Origin() const& {return origin_;}
+
+private:
+
+    /**
+     * @brief Sine of a small angle (|x| <= smallAngle_), Taylor polynomial up to x^9.
+     */
+    static double SmallAngleSin(double x) {
+        double x2{x * x};
+        return x * (1 + x2 * (-1.0 / 6 + x2 * (1.0 / 120 + x2 * (-1.0 / 5040 + x2 * (1.0 / 362880)))));
+    }
+
+    /**
+     * @brief Cosine of a small angle (|x| <= smallAngle_), Taylor polynomial up to x^10.
+     */
+    static double SmallAngleCos(double x) {
+        double x2{x * x};
+        return 1 + x2 * (-1.0 / 2 + x2 * (1.0 / 24 + x2 * (-1.0 / 720 + x2 * (1.0 / 40320 + x2 * (-1.0 / 3628800)))));
+    }
+
+    /**
+     * @brief Arctangent of a small argument (|x| <= smallAngle_), Taylor polynomial up to x^11.
+     */
+    static double SmallAngleAtan(double x) {
+        double x2{x * x};
+        return x * (1 + x2 * (-1.0 / 3 + x2 * (1.0 / 5 + x2 * (-1.0 / 7 + x2 * (1.0 / 9 - x2 / 11)))));
+    }
+
+    /**
+     * @brief ENU coordinates of the point at the given offsets from the origin, given the sine and cosine of the offsets.
+     */
+    void Forward(double sinDeltaLat, double cosDeltaLat, double sinDeltaLon, double cosDeltaLon, double altitude, 
+        double& east, double& north, double& up) const {
+        double sinLat{sinLat0_ * cosDeltaLat + cosLat0_ * sinDeltaLat};
+        double cosLat{cosLat0_ * cosDeltaLat - sinLat0_ * sinDeltaLat};
+        double primeVertical{semiMajorAxis_ / std::sqrt(1 - eccentricity2_ * sinLat * sinLat)};
+        double radial{(primeVertical + altitude) * cosLat};
+        double dx{radial * cosDeltaLon - radial0_};
+        double dz{(primeVertical * (1 - eccentricity2_) + altitude) * sinLat - axial0_};
+        east = radial * sinDeltaLon;
+        north = -sinLat0_ * dx + cosLat0_ * dz;
+        up = cosLat0_ * dx + sinLat0_ * dz;
+    }
+
+    static constexpr double semiMajorAxis_{6378137.0};
+    static constexpr double flattening_{1.0 / 298.257223563};
+    static constexpr double eccentricity2_{flattening_ * (2 - flattening_)};
+    static constexpr double smallAngle_{0.02}; // [rad], about 120 km
+    static constexpr int latitudeIterations_{7}; // The error is reduced by about the eccentricity^2 at each iteration
+
+    Eigen::Vector3d origin_;
+    double latitude0_;
+    double longitude0_;
+    double altitude0_;
+    double sinLat0_;
+    double cosLat0_;
+    double tanLat0_;
+    double radial0_; // Distance of the origin from the Earth axis
+    double axial0_;  // Height of the origin over the equatorial plane
+    double meridianRadius0_;
+    double primeVerticalRadius0_;
+};
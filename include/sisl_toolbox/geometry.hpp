@@ -0,0 +1,233 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <tuple>
+#include <vector>
+#include <eigen3/Eigen/Dense>
+
+/**
+ * @class Geometry
+ *
+ * @brief Static geometric utilities shared by the path builders: angle conversions and normalizations, distances,
+ *        bounding boxes and robust predicates. The scalar versions are inline (constexpr where the standard library allows
+ *        it) and branch-free, the batch versions work on contiguous arrays with loops the compiler can vectorize. The
+ *        predicates (orientation, segment crossing) are exact: a floating point filter answers the common case, an exact
+ *        expansion arithmetic on the stack (Shewchuk) the nearly degenerate ones.
+ */
+class Geometry {
+
+public:
+
+    /**
+     * @brief Transform an angle in degrees in radians.
+     */
+    static constexpr double DegToRad(double angle) {
+        return angle * (M_PI / 180.0);
+    }
+
+    /**
+     * @brief Transform an angle in radians in degrees.
+     */
+    static constexpr double RadToDeg(double angle) {
+        return angle * (180.0 / M_PI);
+    }
+
+    /**
+     * @brief Convert an angle in degrees to [0, 360.0) interval.
+     *
+     * @param[in] angle The angle to be converted.
+     *
+     * @return The angle in [0, 360.0).
+     */
+    static inline double ConvertToAngleInterval(double angle) {
+        const double converted {angle - 360.0 * std::floor(angle / 360.0)};
+        // Tiny negative angles round up to 360.0
+        return converted < 360.0 ? converted : 0.0;
+    }
+
+    /**
+     * @brief Convert an angle in radians to [0, 2pi) interval.
+     *
+     * @param[in] angle The angle to be converted.
+     *
+     * @return The angle in [0, 2pi).
+     */
+    static inline double ConvertToRadInterval(double angle) {
+        const double converted {angle - 2 * M_PI * std::floor(angle / (2 * M_PI))};
+        return converted < 2 * M_PI ? converted : 0.0;
+    }
+
+    /**
+     * @brief Convert in place an array of angles in degrees to [0, 360.0) interval.
+     */
+    static inline void ConvertToAngleInterval(double* angles, std::size_t size) {
+        #pragma omp simd
+        for(std::size_t i = 0; i < size; ++i)
+            angles[i] = ConvertToAngleInterval(angles[i]);
+    }
+
+    static inline void ConvertToAngleInterval(std::vector<double>& angles) {
+        ConvertToAngleInterval(angles.data(), angles.size());
+    }
+
+    /**
+     * @brief Convert in place an array of angles in radians to [0, 2pi) interval.
+     */
+    static inline void ConvertToRadInterval(double* angles, std::size_t size) {
+        #pragma omp simd
+        for(std::size_t i = 0; i < size; ++i)
+            angles[i] = ConvertToRadInterval(angles[i]);
+    }
+
+    static inline void ConvertToRadInterval(std::vector<double>& angles) {
+        ConvertToRadInterval(angles.data(), angles.size());
+    }
+
+    /**
+     * @brief Compute the squared distance between two points.
+     */
+    static inline double SquaredDistance(Eigen::Vector3d const& vec1, Eigen::Vector3d const& vec2) {
+        return (vec1 - vec2).squaredNorm();
+    }
+
+    /**
+     * @brief Compute the distance between two points.
+     */
+    static inline double Distance(Eigen::Vector3d const& vec1, Eigen::Vector3d const& vec2) {
+        return (vec1 - vec2).norm();
+    }
+
+    /**
+     * @brief Compute the rectangle (aligned with the axes) surrounding the xy projection of the points.
+     *
+     * @param[in] points Pointer to the first point.
+     * @param[in] size Number of points. For an empty span the box is empty: the maxima are -inf and the minima +inf.
+     *
+     * @return A tuple with: (maxX, minX, maxY, minY)
+     */
+    static inline std::tuple<double, double, double, double> BoundingBox(Eigen::Vector3d const* points, std::size_t size) {
+        double maxX {-std::numeric_limits<double>::infinity()};
+        double minX {std::numeric_limits<double>::infinity()};
+        double maxY {-std::numeric_limits<double>::infinity()};
+        double minY {std::numeric_limits<double>::infinity()};
+
+        #pragma omp simd reduction(max:maxX, maxY) reduction(min:minX, minY)
+        for(std::size_t i = 0; i < size; ++i) {
+            maxX = std::max(maxX, points[i][0]);
+            minX = std::min(minX, points[i][0]);
+            maxY = std::max(maxY, points[i][1]);
+            minY = std::min(minY, points[i][1]);
+        }
+
+        return std::make_tuple(maxX, minX, maxY, minY);
+    }
+
+    static inline std::tuple<double, double, double, double> BoundingBox(std::vector<Eigen::Vector3d> const& points) {
+        return BoundingBox(points.data(), points.size());
+    }
+
+    /**
+     * @brief Orientation of three points: positive if a, b, c turn counterclockwise, negative if clockwise, null if they
+     *        are collinear. The sign is exact.
+     *
+     * @return Twice the signed area of the triangle (a, b, c), approximated, with the exact sign.
+     */
+    static inline double Orient2d(Eigen::Vector2d const& a, Eigen::Vector2d const& b, Eigen::Vector2d const& c) {
+        const double detLeft {(a[0] - c[0]) * (b[1] - c[1])};
+        const double detRight {(a[1] - c[1]) * (b[0] - c[0])};
+        const double det {detLeft - detRight};
+
+        // Error bound of the floating point evaluation (Shewchuk's ccwerrboundA): beyond it the sign is certain.
+        constexpr double epsilon {std::numeric_limits<double>::epsilon() / 2};
+        const double errorBound {(3.0 + 16.0 * epsilon) * epsilon * (std::abs(detLeft) + std::abs(detRight))};
+        if(det > errorBound or -det > errorBound)
+            return det;
+
+        return Orient2dExact(a, b, c);
+    }
+
+    /**
+     * @brief Check if two segments (p1, p2) and (q1, q2) share at least a point, touching ends and collinear overlaps
+     *        included. Exact.
+     */
+    static inline bool SegmentsIntersect(Eigen::Vector2d const& p1, Eigen::Vector2d const& p2, Eigen::Vector2d const& q1,
+        Eigen::Vector2d const& q2) {
+        const double o1 {Orient2d(p1, p2, q1)};
+        const double o2 {Orient2d(p1, p2, q2)};
+
+        if(o1 == 0 and o2 == 0) {
+            // Collinear: overlap of the projections on the x axis (y axis for vertical segments).
+            const int k {p1[0] != p2[0] or q1[0] != q2[0] ? 0 : 1};
+            return std::max(std::min(p1[k], p2[k]), std::min(q1[k], q2[k])) <= std::min(std::max(p1[k], p2[k]), std::max(q1[k], q2[k]));
+        }
+
+        const double o3 {Orient2d(q1, q2, p1)};
+        const double o4 {Orient2d(q1, q2, p2)};
+
+        return ((o1 <= 0 and o2 >= 0) or (o1 >= 0 and o2 <= 0)) and ((o3 <= 0 and o4 >= 0) or (o3 >= 0 and o4 <= 0));
+    }
+
+    /**
+     * @brief Append a point unless it is within tolerance of a point already in the vector.
+     *
+     * @return True if the point has been appended.
+     */
+    static inline bool AddUniquePoint(std::vector<Eigen::Vector3d>& points, Eigen::Vector3d const& point, double tolerance) {
+        for(auto const& other: points) {
+            if((other - point).squaredNorm() <= tolerance * tolerance)
+                return false;
+        }
+        points.push_back(point);
+        return true;
+    }
+
+private:
+
+    /**
+     * @brief Error free transformations: a + b = sum + error, a * b = product + error.
+     */
+    static inline void TwoSum(double a, double b, double& sum, double& error) {
+        sum = a + b;
+        const double bVirtual {sum - a};
+        const double aVirtual {sum - bVirtual};
+        error = (a - aVirtual) + (b - bVirtual);
+    }
+
+    static inline void TwoProduct(double a, double b, double& product, double& error) {
+        product = a * b;
+        error = std::fma(a, b, -product);
+    }
+
+    /**
+     * @brief Exact orientation: the six products of the expanded determinant are summed in a nonoverlapping expansion 
+     *        (Shewchuk's grow expansion), whose largest component has the sign of the determinant.
+     */
+    static inline double Orient2dExact(Eigen::Vector2d const& a, Eigen::Vector2d const& b, Eigen::Vector2d const& c) {
+        const double factors[6][2] {{a[0], b[1]}, {-a[0], c[1]}, {-b[1], c[0]}, {-a[1], b[0]}, {a[1], c[0]}, {b[0], c[1]}};
+
+        double expansion[12];
+        int size {0};
+        auto grow = [&expansion, &size](double value) {
+            for(int i = 0; i < size; ++i)
+                TwoSum(value, expansion[i], value, expansion[i]);
+            expansion[size++] = value;
+        };
+
+        for(auto const& factor: factors) {
+            double product {0};
+            double error {0};
+            TwoProduct(factor[0], factor[1], product, error);
+            grow(error);
+            grow(product);
+        }
+
+        for(int i = size - 1; i >= 0; --i) {
+            if(expansion[i] != 0)
+                return expansion[i];
+        }
+        return 0;
+    }
+};
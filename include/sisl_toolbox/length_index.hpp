@@ -0,0 +1,71 @@
+#pragma once
+
+#include <vector>
+
+/**
+ * @class LengthIndex
+ *
+ * @brief Cumulative lengths of the curves of a path stored in a Fenwick (binary indexed) tree: the start abscissa of a
+ *        curve, the curve containing an abscissa, the update of a length and the append of a curve take O(log n). An
+ *        insertion or removal in the middle shifts the following lengths and rebuilds the tree in O(n), with a single
+ *        linear pass and no call to the curves (the same order of the shift of the curves vector).
+ */
+class LengthIndex {
+
+public:
+
+    LengthIndex() = default;
+
+    /**
+     * @brief Replace the whole content with the given lengths, in O(n).
+     */
+    void Assign(std::vector<double> const& lengths);
+
+    /**
+     * @brief Append a length, in O(log n).
+     */
+    void PushBack(double length);
+
+    /**
+     * @brief Set the length of an entry, in O(log n).
+     */
+    void Update(int id, double length);
+
+    /**
+     * @brief Remove the entries in [first, first + erased) and insert the given lengths in their place, in O(n), or in
+     *        O(k log n) when k lengths replace k entries.
+     */
+    void Splice(int first, int erased, std::vector<double> const& lengths);
+
+    /**
+     * @brief Sum of the first count lengths (the start abscissa of the entry count), in O(log n).
+     */
+    double Prefix(int count) const;
+
+    /**
+     * @brief Find the entry containing an abscissa, i.e. the first entry whose cumulative end is not before the abscissa
+     *        (an abscissa on the boundary of two entries belongs to the first one), in O(log n). Abscissae beyond the total
+     *        length give the last entry.
+     *
+     * @param[in] abscissa_m Abscissa, measured from the start of the first entry.
+     * @param[out] offset_m Abscissa measured from the start of the entry found.
+     *
+     * @return The id of the entry, -1 if the index is empty.
+     */
+    int Find(double abscissa_m, double& offset_m) const;
+
+    // Getters
+    auto Size() const& {return static_cast<int>(lengths_.size());}
+    auto Length(int id) const& {return lengths_[id];}
+    auto Total() const& {return Prefix(Size());}
+
+private:
+
+    /**
+     * @brief Build the tree from lengths_ in O(n).
+     */
+    void Build();
+
+    std::vector<double> lengths_;
+    std::vector<double> tree_; // 1-based: tree_[i] is the sum of the lengths in (i - lowbit(i), i]
+};
@@ -7,8 +7,14 @@
 #include <map>
 #include <eigen3/Eigen/Dense>
 
+#include "sisl_toolbox/length_index.hpp"
+
 class PathFactory;
+class PathView;
+class PathHorizon;
+class CoveragePlanner;
 class Curve;
+class SegmentKernel;
 
 /**
  * @class Path
@@ -28,15 +34,78 @@ public:
      */
     template <typename T>
     void AddCurveBack(std::shared_ptr<T> curve) {
-        curves_.push_back(curve);
-        endParameter_m_ += curve->Length();
-        length_ = endParameter_m_ - startParameter_m_;
-        ++curvesNumber_; 
+        Insert(curvesNumber_, curve);
     }
 
     /**
-     * @brief Convert from Abscissa path parameter to Abscissa curve parameter. If the abscissa_m is beyond of before the 
-     * path parametrization extrema.
+     * @brief Add a curve front. The abscissae of the other curves are shifted by its length.
+     * 
+     * @param curve std::shared_ptr<T> with T in (StraightLine, CircularArc, GenericCurve). The curve to be added.
+     */
+    template <typename T>
+    void AddCurveFront(std::shared_ptr<T> curve) {
+        Insert(0, curve);
+    }
+
+    /**
+     * @brief Insert a curve before the curve curveId (at the end if curveId is the number of curves). The cumulative lengths
+     *        are kept in a Fenwick tree (see LengthIndex) and the segment kernel is updated incrementally: appending a curve
+     *        takes O(log n), an insertion in the middle a shift of the following entries without evaluating their curves.
+     *        Throw an exception if curveId is out of [0, CurvesNumber()].
+     * 
+     * @param[in] curveId Position of the new curve.
+     * @param[in] curve The curve to be inserted.
+     */
+    void Insert(int curveId, std::shared_ptr<Curve> curve);
+
+    /**
+     * @brief Remove the curves in [firstCurve, firstCurve + count), e.g. the completed legs at the front of the path. 
+     *        Throw an exception if the range is out of bound.
+     * 
+     * @param[in] firstCurve Id of the first curve to be removed.
+     * @param[in] count Number of curves to be removed.
+     */
+    void Erase(int firstCurve, int count = 1);
+
+    /**
+     * @brief Replace the curve curveId, in O(log n) for the cumulative lengths. Throw an exception if curveId is out of bound.
+     * 
+     * @param[in] curveId Id of the curve to be replaced.
+     * @param[in] curve The new curve.
+     */
+    void Replace(int curveId, std::shared_ptr<Curve> curve);
+
+    /**
+     * @brief Set the curve curveId, keeping the length index, the parametrization and the segment kernel up to date (see 
+     *        Replace). Throw an exception if curveId is out of bound.
+     * 
+     * @param[in] curveId Id of the curve to be set.
+     * @param[in] curve The new curve.
+     */
+    void SetCurve(int curveId, std::shared_ptr<Curve> curve) {Replace(curveId, 1, {curve});}
+
+    /**
+     * @brief Replace the curves in [firstCurve, firstCurve + count) with a sequence of curves, e.g. a detour. Throw an 
+     *        exception if the range is out of bound.
+     * 
+     * @param[in] firstCurve Id of the first curve to be replaced.
+     * @param[in] count Number of curves to be replaced (0 for a pure insertion).
+     * @param[in] curves The new curves.
+     */
+    void Replace(int firstCurve, int count, std::vector<std::shared_ptr<Curve>> const& curves);
+
+    /**
+     * @brief Append all the curves of another path. The curve objects are shared (aliased), not copied, and the lengths of 
+     *        the other path are added to the index in a single pass (see CompositePath to concatenate paths without touching 
+     *        their curves at all). Reverse copies the curves, so it does not affect the other path.
+     * 
+     * @param[in] other The path to be appended (it can be the path itself).
+     */
+    void Append(Path const& other);
+
+    /**
+     * @brief Convert from Abscissa path parameter to Abscissa curve parameter, in O(log n). If the abscissa_m is beyond or 
+     * before the path parametrization extrema, an exception is thrown.
      * 
      * @param[in] abscissa_m Path abscissa value.
      *  
@@ -45,8 +114,8 @@ public:
     std::tuple<double, int> PathAbsToCurveAbs(double abscissa_m);
 
     /**
-     * @brief Convert from Abscissa curve parameter to Abscissa path parameter. If the abscissaCurve_m is beyond or before the 
-     * curve parametrization extrema, an exception is thrown.
+     * @brief Convert from Abscissa curve parameter to Abscissa path parameter, in O(log n). If the abscissaCurve_m is beyond 
+     * or before the curve parametrization extrema, an exception is thrown.
      * 
      * @param[in] abscissaCurve_m Curve abscissa value.
      * @param[in] curveId Identifier for the curve.
@@ -94,12 +163,14 @@ public:
     std::shared_ptr<std::vector<Eigen::Vector3d>> Sampling(int samples) const;
 
     /**
-     * @brief Reverse the whole path
+     * @brief Reverse the whole path. The reversed curves are new objects (see Curve::Clone): the curves shared with other 
+     *        paths are not changed.
      */
     void Reverse();
     
     /**
-     * @brief Find Closest Point w.r.t. the path.
+     * @brief Find Closest Point w.r.t. the path. The straight lines of the path are processed all together by a vectorised 
+     *        point to segment kernel (see SegmentKernel), the other curves one at a time through SISL.
      * 
      * @param[in] worldF_position point in the find closest point problem.
      * @param[out] curveId Id of the curve containing the closest point.
@@ -129,7 +200,9 @@ public:
     double FindAbscissaClosestPoint(Eigen::Vector3d& worldF_position);
 
     /**
-     * @brief Find Abscissa of the Closest Point on an interval of the path.  
+     * @brief Find Abscissa of the Closest Point on an interval of the path, without extracting the path section: the 
+     *        partial curves at the ends are searched on their portion only (the straight lines on the segment kernel), the 
+     *        curves in between as in FindAbscissaClosestPoint.
      * 
      * @param[in] worldF_position point in the find closest point problem.
      * @param[in] start first abscissa value of the path section.
@@ -197,8 +270,45 @@ public:
     */
     void EvalTangentFrame(double abscissa_m, Eigen::Vector3d& tangent, Eigen::Vector3d& normal, Eigen::Vector3d& binormal);
 
-    // Define [] operator
-    std::shared_ptr<Curve>& operator[](std::size_t const idx) { return curves_[idx]; }
+    /**
+     * @brief Build a path with fewer, bigger curves describing the same geometry within tolerance: consecutive collinear 
+     *        straight lines are merged in a single straight line, consecutive circular arcs with the same centre, radius and 
+     *        turning direction in a single arc. Optionally the runs of curves with a SISL representation are joined in a 
+     *        single spline (s1715() SISL routine), which gives up the exact arc length parametrization of lines and arcs.
+     * 
+     * @param[in] tolerance Geometric tolerance of the merging.
+     * @param[in] joinCurves If true, join the consecutive curves in splines after merging lines and arcs.
+     *  
+     * @return std::shared_ptr<Path> containing the simplified path. The current path is not modified.
+     */
+    std::shared_ptr<Path> Simplify(double tolerance = 0.001, bool joinCurves = false);
+
+    /**
+     * @brief Build the planar offset (parallel) path at a given signed distance. Each curve is offset on its own (lines and arcs 
+     *        exactly, the others through an approximation within tolerance), the parts where the offset would have a cusp 
+     *        are dropped and consecutive offset curves are joined: trimmed at their intersection on the concave side, connected 
+     *        with a round arc around the original vertex on the convex side. A closed path gives back a closed offset path.
+     *        Only the loops among consecutive curves are trimmed: throw an exception if the offset path intersects itself 
+     *        elsewhere (e.g. an inward offset wider than a narrow part of the path).
+     * 
+     * @param[in] distance Signed offset distance, positive on the left w.r.t. the direction of travel.
+     * @param[in] tolerance Geometric tolerance used for the approximation and for the junctions.
+     *  
+     * @return std::shared_ptr<Path> containing the offset path (empty if the whole path degenerates).
+     */
+    std::shared_ptr<Path> Offset(double distance, double tolerance = 0.001);
+
+    /**
+     * @brief Build a family of offset paths, e.g. the lanes of a coverage formation around the current path.
+     * 
+     * @param[in] distances Signed offset distances, positive on the left w.r.t. the direction of travel.
+     * @param[in] tolerance Geometric tolerance used for the approximation and for the junctions.
+     *  
+     * @return std::vector<std::shared_ptr<Path>> containing an offset path for each distance.
+     */
+    std::vector<std::shared_ptr<Path>> Offset(std::vector<double> const& distances, double tolerance = 0.001);
+
+    // Define [] operator, read only (use SetCurve or Replace to change a curve).
     const std::shared_ptr<Curve>& operator[](std::size_t const idx) const { return curves_[idx]; }
 
 
@@ -232,8 +342,70 @@ public:
 private:
 
     friend PathFactory;
+    friend PathView;
+    friend PathHorizon;
+    friend CoveragePlanner;
+
+    /**
+     * @brief Split a curve in the sections where its offset at the given distance is regular (1 - distance * curvature > 0).
+     *        Lines, arcs and clothoids handle the degenerate part by themselves and are given back as they are.
+     */
+    static std::vector<std::shared_ptr<Curve>> RegularOffsetSections(std::shared_ptr<Curve> const& curve, double distance);
+
+    /**
+     * @brief Join two consecutive offset curves. If they intersect they are trimmed at the intersection closest to the original 
+     *        vertex (a curve fully trimmed away is set to nullptr), otherwise the connecting curve is given back.
+     *
+     * @return The connecting curve, nullptr if no connection is needed.
+     */
+    static std::shared_ptr<Curve> JoinOffsetCurves(std::shared_ptr<Curve>& previous, std::shared_ptr<Curve>& next, 
+        Eigen::Vector3d const& vertex, double distance, double tolerance);
+
+    /**
+     * @brief Replace the curves in [firstCurve, firstCurve + erasedCurves) with the given curves and update the length 
+     *        index, the parametrization and (if already built) the segment kernel.
+     */
+    void Splice(int firstCurve, int erasedCurves, std::vector<std::shared_ptr<Curve>> const& curves);
+
+    /**
+     * @brief Cumulative lengths of the curves, rebuilt only after Reverse.
+     */
+    LengthIndex const& Lengths();
+
+    /**
+     * @brief Segment kernel of the straight lines of the path, built at the first use and then updated by the changes of
+     *        the curves (dropped by Reverse).
+     */
+    SegmentKernel const& Kernel();
+
+    /**
+     * @brief Closest point search among the curves in [firstCurve, lastCurve]: the straight lines through the segment kernel, 
+     *        the other curves through their own FindClosestPoint.
+     *
+     * @return A tuple containing respectively: curve Id, abscissa (in meters) on the curve, distance.
+     */
+    std::tuple<int, double, double> FindClosestCurve(Eigen::Vector3d& worldF_position, int firstCurve, int lastCurve);
+
+    /**
+     * @brief Closest point search on the portion [startValue_m, endValue_m] of the path: the partial curves at the ends on
+     *        their portion only, the curves in between as in FindClosestCurve. Throw an exception if the portion is out of 
+     *        the path parametrization.
+     *
+     * @return A tuple containing respectively: curve Id (-1 if the portion has only null length curves), abscissa (in 
+     *         meters) on the curve, distance.
+     */
+    std::tuple<int, double, double> FindClosestCurveOnInterval(Eigen::Vector3d& worldF_position, double startValue_m, 
+        double endValue_m);
+
+    /**
+     * @brief Path abscissa of an abscissa of the curve curveId, in O(log n), without bound checks.
+     */
+    double PathAbscissa(int curveId, double abscissaCurve_m);
 
     std::vector<std::shared_ptr<Curve>> curves_;
+    std::shared_ptr<SegmentKernel> segmentKernel_;
+    LengthIndex lengthIndex_;
+    bool lengthIndexValid_{true};
     int curvesNumber_;
     double length_;
     double startParameter_m_;
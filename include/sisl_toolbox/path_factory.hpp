@@ -3,6 +3,7 @@
 #include <iostream>
 #include <memory>
 #include <vector>
+#include <array>
 #include <eigen3/Eigen/Dense>
 
 
@@ -10,6 +11,9 @@
 #define LEFT 2
 
 class Path;
+class Curve;
+class GeodeticFrame;
+class PlanarPath;
 
 /**
  * @class PathFactory (abstract)
@@ -40,6 +44,34 @@ public:
      */ 
     static std::shared_ptr<Path> NewPolygon(std::vector<Eigen::Vector3d> points);
 
+    /**
+     * @brief Generate a PolygonalChain with rounded corners. Each corner is replaced by a tangent circular arc of the given 
+     *        radius (or, on horizontal corners with transitionLength > 0, by clothoid -> circular arc -> clothoid) and the 
+     *        adjacent straight lines are trimmed. The corners are computed analytically and independently of each other (in 
+     *        parallel when OpenMP is enabled). If a corner does not fit in half of the adjacent segments, its radius is 
+     *        reduced (and the clothoids are dropped). It needs at least 2 points, otherwise it throws an exception.
+     * 
+     * @param[in] points The points chracterizing the polygonal chain.
+     * @param[in] radius Radius of the corner arcs.
+     * @param[in] transitionLength If positive, length of the clothoid transitions entering and leaving each corner arc.
+     * 
+     * @return A shared_ptr pointing to a rounded Polygonal Chain described as a Path object.
+     */
+    static std::shared_ptr<Path> NewRoundedPolygonalChain(std::vector<Eigen::Vector3d> points, double radius, 
+                                                        double transitionLength = 0.0);
+
+    /**
+     * @brief Generate a Polygon with rounded corners (see NewRoundedPolygonalChain). The path starts at the end of the first 
+     *        rounded corner and it is closed. It needs at least 3 points, otherwise it throws an exception.
+     * 
+     * @param[in] points The points chracterizing the polygon.
+     * @param[in] radius Radius of the corner arcs.
+     * @param[in] transitionLength If positive, length of the clothoid transitions entering and leaving each corner arc.
+     * 
+     * @return A shared_ptr pointing to a rounded Polygon described as a Path object.
+     */ 
+    static std::shared_ptr<Path> NewRoundedPolygon(std::vector<Eigen::Vector3d> points, double radius, double transitionLength = 0.0);
+
     /**
      * @brief Generate an Hippodrome starting from 4 points. If the points are not 4, an exception is thrown.
      * 
@@ -71,11 +103,31 @@ public:
      * @param[in] firstRadius Radius of the first circular arc.
      * @param[in] secondRadius Radius of the second circular arc.
      * @param[in] polygonVerteces The polygon defining the area that must be filled with the Race Track.
+     * @param[in] transitionLength If positive, length of the clothoid transitions inserted between straight lines and
+     *            circular arcs (see AddClothoidTransitions).
      * 
      * @return A shared_ptr pointing to a Race Track described as a Path object.
      */    
     static std::shared_ptr<Path> NewRaceTrack(double angle, int direction, double firstRadius, double secondRadius, 
-                                            std::vector<Eigen::Vector3d>& polygonVerteces);
+                                            std::vector<Eigen::Vector3d>& polygonVerteces, double transitionLength = 0.0);
+
+    /**
+     * @brief Generate a Race Track from a polygon given in geodetic coordinates. The vertices are converted to the ENU frame 
+     *        of the GeodeticFrame and projected on its tangent plane (z = 0), where the path is built (see NewRaceTrack).
+     * 
+     * @param[in] angle Angle of the path w.r.t. the x-axis (east).
+     * @param[in] direction The turning direction.
+     * @param[in] firstRadius Radius of the first circular arc.
+     * @param[in] secondRadius Radius of the second circular arc.
+     * @param[in] frame The local frame where the path is built.
+     * @param[in] geodeticVerteces The polygon vertices as (latitude [deg], longitude [deg], altitude [m]).
+     * @param[in] transitionLength If positive, length of the clothoid transitions.
+     * 
+     * @return A shared_ptr pointing to a Race Track described as a Path object in the ENU frame.
+     */    
+    static std::shared_ptr<Path> NewRaceTrack(double angle, int direction, double firstRadius, double secondRadius, 
+                                            GeodeticFrame const& frame, std::vector<Eigen::Vector3d> const& geodeticVerteces, 
+                                            double transitionLength = 0.0);
 
     /**
      * @brief Generate a Serpentine. It is composed of straight lines with an angle w.r.t the x-axis specified by "angle", 
@@ -86,79 +138,229 @@ public:
      * @param[in] direction The turning direction.
      * @param[in] offset Distance among the straight lines, also defining the circular arc diameter.
      * @param[in] polygonVerteces The polygon defining the area that must be filled with the Race Track.
+     * @param[in] transitionLength If positive, length of the clothoid transitions inserted between straight lines and
+     *            circular arcs (see AddClothoidTransitions).
      * 
      * @return A shared_ptr pointing to a Serpentine described as a Path object.
      */   
     static std::shared_ptr<Path> NewSerpentine(double angle, int direction, double offset, 
-                                                std::vector<Eigen::Vector3d>& polygonVerteces);
+                                                std::vector<Eigen::Vector3d>& polygonVerteces, double transitionLength = 0.0);
 
-private: 
-    /** 
-     * @brief Convert an angle in degrees to [0, 360.0) interval
+    /**
+     * @brief Generate the shortest Dubins path (forward motion, bounded curvature) between two planar poses. All the six words 
+     *        (LSL, RSR, LSR, RSL, RLR, LRL) are evaluated in closed form and the shortest one is emitted as circular arcs and 
+     *        a straight line. The path lies on the plane z = startPoint[2].
      * 
-     * @param[in] angle The angle to be converted passed by copy
+     * @param[in] startPoint Start position.
+     * @param[in] startHeading Start heading (in rad) w.r.t. the x-axis.
+     * @param[in] endPoint End position.
+     * @param[in] endHeading End heading (in rad) w.r.t. the x-axis.
+     * @param[in] radius Minimum turning radius.
      * 
-     * @return The along curve distance in meters from the stating point of the curve to abscissa parameter.
-     */ 
-    static auto ConvertToAngleInterval (double angle) {
-        while(angle < 0) { angle += 360.0; }
-        return std::fmod(angle, 360.0);
-    };
+     * @return A shared_ptr pointing to the Dubins path described as a Path object.
+     */
+    static std::shared_ptr<Path> NewDubinsPath(Eigen::Vector3d startPoint, double startHeading, Eigen::Vector3d endPoint, 
+                                            double endHeading, double radius);
 
-    /** 
-     * @brief Given the vertices of a polygon, compute the rectangle surrounding the figure (with 3 decimals precision).
+    /**
+     * @brief Length of the shortest Dubins path between two planar poses, without building it (no allocations). Useful to 
+     *        compare many candidate connections before building the chosen one with NewDubinsPath.
      * 
-     * @param[in] polygonVerteces const reference to the vector containing polygon's vertices
+     * @param[in] startPoint Start position.
+     * @param[in] startHeading Start heading (in rad) w.r.t. the x-axis.
+     * @param[in] endPoint End position.
+     * @param[in] endHeading End heading (in rad) w.r.t. the x-axis.
+     * @param[in] radius Minimum turning radius.
      * 
-     * @return A tuple with: (maxX, minX, maxY, minY)
-     */ 
-    static std::tuple<double, double, double, double> evalRectangleBoundingBox (std::vector<Eigen::Vector3d> const& polygonVerteces) {
-        double maxX{polygonVerteces[0][0]}; 
-        double minX{polygonVerteces[0][0]};
-        double maxY{polygonVerteces[0][1]};
-        double minY{polygonVerteces[0][1]};
-        for(std::size_t i = 1; i < polygonVerteces.size(); i++) {
-            if(maxX < polygonVerteces[i][0])
-                maxX = polygonVerteces[i][0];
-            if(minX > polygonVerteces[i][0])
-                minX = polygonVerteces[i][0];   
-
-            if(maxY < polygonVerteces[i][1])
-                maxY = polygonVerteces[i][1];
-            if(minY > polygonVerteces[i][1])
-                minY = polygonVerteces[i][1];  
-        }
-        // Set the vertices precision
-        return std::make_tuple(std::round(maxX * 1000) / 1000, std::round(minX * 1000) / 1000, 
-                               std::round(maxY * 1000) / 1000, std::round(minY * 1000) / 1000);
-    };
+     * @return The length of the shortest Dubins path.
+     */
+    static double DubinsLength(Eigen::Vector3d const& startPoint, double startHeading, Eigen::Vector3d const& endPoint, 
+                            double endHeading, double radius);
 
-    /** 
-     * @brief Compute distance between two points
+    /**
+     * @brief Generate a Serpentine from a polygon given in geodetic coordinates. The vertices are converted to the ENU frame 
+     *        of the GeodeticFrame and projected on its tangent plane (z = 0), where the path is built (see NewSerpentine).
      * 
-     * @param[in] vec1 First point expresed as Eigen::Vector3d
-     * @param[in] vec2 Second point expresed as Eigen::Vector3d
+     * @param[in] angle Angle of the path w.r.t. the x-axis (east).
+     * @param[in] direction The turning direction.
+     * @param[in] offset Distance among the straight lines, also defining the circular arc diameter.
+     * @param[in] frame The local frame where the path is built.
+     * @param[in] geodeticVerteces The polygon vertices as (latitude [deg], longitude [deg], altitude [m]).
+     * @param[in] transitionLength If positive, length of the clothoid transitions.
      * 
-     * @return Distance between two points
-     */ 
-    static auto Distance (Eigen::Vector3d const& vec1, Eigen::Vector3d const& vec2) {
-        return std::sqrt(std::pow(vec1[0] - vec2[0], 2) + std::pow(vec1[1] - vec2[1], 2) + std::pow(vec1[2] - vec2[2], 2));
-    };
+     * @return A shared_ptr pointing to a Serpentine described as a Path object in the ENU frame.
+     */   
+    static std::shared_ptr<Path> NewSerpentine(double angle, int direction, double offset, GeodeticFrame const& frame, 
+                                                std::vector<Eigen::Vector3d> const& geodeticVerteces, double transitionLength = 0.0);
 
-     /** 
-     * @brief Transform an angle in degrees in radians
+    /**
+     * @brief Generate a planar PolygonalChain (see NewPolygonalChain) directly as a PlanarPath. It needs at least 2 points, 
+     *        otherwise it throws an exception.
      * 
-     * @param[in] angle degrees
+     * @param[in] points The points chracterizing the polygonal chain.
      * 
-     * @return Angle in radians
-     */ 
-    static auto DegToRad (double angle) {
-        return angle * M_PI / 180.0;
-    };
+     * @return A shared_ptr pointing to a Polygonal Chain described as a PlanarPath object.
+     */
+    static std::shared_ptr<PlanarPath> NewPlanarPolygonalChain(std::vector<Eigen::Vector2d> const& points);
+
+    /**
+     * @brief Generate a planar Polygon (see NewPolygon) directly as a PlanarPath. It needs at least 3 points, otherwise it 
+     *        throws an exception.
+     * 
+     * @param[in] points The points chracterizing the polygon.
+     * 
+     * @return A shared_ptr pointing to a Polygon described as a PlanarPath object.
+     */
+    static std::shared_ptr<PlanarPath> NewPlanarPolygon(std::vector<Eigen::Vector2d> const& points);
+
+    /**
+     * @brief Generate a planar PolygonalChain with rounded corners (see NewRoundedPolygonalChain) directly as a PlanarPath.
+     * 
+     * @param[in] points The points chracterizing the polygonal chain.
+     * @param[in] radius Radius of the corner arcs.
+     * @param[in] transitionLength If positive, length of the clothoid transitions entering and leaving each corner arc.
+     * 
+     * @return A shared_ptr pointing to a rounded Polygonal Chain described as a PlanarPath object.
+     */
+    static std::shared_ptr<PlanarPath> NewPlanarRoundedPolygonalChain(std::vector<Eigen::Vector2d> const& points, double radius, 
+                                                                    double transitionLength = 0.0);
+
+    /**
+     * @brief Generate a planar Polygon with rounded corners (see NewRoundedPolygon) directly as a PlanarPath.
+     * 
+     * @param[in] points The points chracterizing the polygon.
+     * @param[in] radius Radius of the corner arcs.
+     * @param[in] transitionLength If positive, length of the clothoid transitions entering and leaving each corner arc.
+     * 
+     * @return A shared_ptr pointing to a rounded Polygon described as a PlanarPath object.
+     */
+    static std::shared_ptr<PlanarPath> NewPlanarRoundedPolygon(std::vector<Eigen::Vector2d> const& points, double radius, 
+                                                            double transitionLength = 0.0);
+
+    /**
+     * @brief Generate the shortest Dubins path (see NewDubinsPath) directly as a PlanarPath.
+     * 
+     * @param[in] startPoint Start position.
+     * @param[in] startHeading Start heading (in rad) w.r.t. the x-axis.
+     * @param[in] endPoint End position.
+     * @param[in] endHeading End heading (in rad) w.r.t. the x-axis.
+     * @param[in] radius Minimum turning radius.
+     * 
+     * @return A shared_ptr pointing to the Dubins path described as a PlanarPath object.
+     */
+    static std::shared_ptr<PlanarPath> NewPlanarDubinsPath(Eigen::Vector2d const& startPoint, double startHeading, 
+                                                        Eigen::Vector2d const& endPoint, double endHeading, double radius);
+
+    /**
+     * @brief Remove the curvature jumps of a path made of straight lines and circular arcs. Each sequence straight line -> 
+     *        circular arc -> straight line is replaced by straight line -> clothoid -> circular arc -> clothoid -> straight line.
+     *        The arc keeps its centre and its radius is reduced so that the new curves remain tangent to both straight lines, 
+     *        which are trimmed accordingly. A turn is left unchanged when the straight lines are too short or the arc angle 
+     *        is too small for the transitions.
+     * 
+     * @param[in] path The path to be smoothed. It is not modified.
+     * @param[in] transitionLength Length of each clothoid transition.
+     * 
+     * @return A shared_ptr pointing to the new Path object.
+     */
+    static std::shared_ptr<Path> AddClothoidTransitions(std::shared_ptr<Path> path, double transitionLength);
 
-    static auto RadToDeg (double angle) {
-        return angle * 180.0 / M_PI;
+private: 
+
+    /**
+     * @brief Geometry of a rounded polygon corner, shared by RoundCorner and RoundPlanarCorner.
+     */
+    struct Corner {
+        bool rounded {false};           // False if the corner is left sharp (collinear or degenerate segments)
+        bool transitions {false};       // Clothoid -> arc -> clothoid, else a single tangent arc
+        Eigen::Vector3d entry {};       // Point where the rounded corner leaves the incoming segment
+        Eigen::Vector3d exit {};        // Point where the rounded corner joins the outgoing segment
+        Eigen::Vector3d axis {};        // Unit rotation axis of the turn
+        Eigen::Vector3d inward {};      // Towards the centre, orthogonal to the incoming segment
+        Eigen::Vector3d centre {};      // Centre of the arc
+        double deflection {0};          // Angle between the two segments
+        double radius {0};              // Radius of the arc, reduced if a single arc does not fit
+        double transitionAngle {0};     // Heading change along each clothoid transition
+        double arcAngle {0};            // Angle of the arc (the deflection without the transitions)
+        double heading {0};             // Heading of the incoming segment, for the horizontal corners
+        double turn {0};                // 1 if the corner turns counterclockwise around the z-axis, -1 otherwise
     };
 
+    /**
+     * @brief Compute the geometry of a polygon corner: a tangent arc, or clothoid -> arc -> clothoid on the horizontal 
+     *        corners when the transitions fit. Each corner may use at most half of the adjacent segments.
+     * 
+     * @param[in] previous The vertex before the corner.
+     * @param[in] vertex The corner vertex.
+     * @param[in] next The vertex after the corner.
+     * @param[in] radius Radius of the corner arc.
+     * @param[in] transitionLength Length of the clothoid transitions (no transitions if not positive).
+     */
+    static Corner CornerGeometry(Eigen::Vector3d const& previous, Eigen::Vector3d const& vertex, Eigen::Vector3d const& next, 
+        double radius, double transitionLength);
+
+    /**
+     * @brief Curves replacing a polygon corner, see NewRoundedPolygonalChain.
+     * 
+     * @param[in] previous The vertex before the corner.
+     * @param[in] vertex The corner vertex.
+     * @param[in] next The vertex after the corner.
+     * @param[in] radius Radius of the corner arc.
+     * @param[in] transitionLength Length of the clothoid transitions (no transitions if not positive).
+     * @param[out] entry Point where the rounded corner leaves the incoming segment.
+     * @param[out] exit Point where the rounded corner joins the outgoing segment.
+     * 
+     * @return The curves from entry to exit, empty if the corner is left sharp (collinear or degenerate segments).
+     */
+    static std::vector<std::shared_ptr<Curve>> RoundCorner(Eigen::Vector3d const& previous, Eigen::Vector3d const& vertex, 
+        Eigen::Vector3d const& next, double radius, double transitionLength, Eigen::Vector3d& entry, Eigen::Vector3d& exit);
+
+    /**
+     * @brief Planar version of RoundCorner (same CornerGeometry): the segments replacing the corner are appended to corner.
+     */
+    static void RoundPlanarCorner(Eigen::Vector2d const& previous, Eigen::Vector2d const& vertex, Eigen::Vector2d const& next, 
+        double radius, double transitionLength, PlanarPath& corner, Eigen::Vector2d& entry, Eigen::Vector2d& exit);
+
+    /**
+     * @brief Planar version of RoundCorners.
+     */
+    static std::shared_ptr<PlanarPath> RoundPlanarCorners(std::vector<Eigen::Vector2d> const& points, double radius, 
+        double transitionLength, bool closed);
+
+    /**
+     * @brief Normalized lengths (angles for the turns, length / radius for the straight line) of a Dubins word, in closed form.
+     * 
+     * @param[in] word Index of the word in DubinsWords.
+     * @param[in] alpha Start heading w.r.t. the line joining the two positions, in [0, 2pi).
+     * @param[in] beta End heading w.r.t. the line joining the two positions, in [0, 2pi).
+     * @param[in] distance Distance between the two positions divided by the radius.
+     * @param[out] lengths The normalized lengths of the three segments.
+     * 
+     * @return False if the word does not exist for the given poses.
+     */
+    static bool DubinsWord(int word, double alpha, double beta, double distance, std::array<double, 3>& lengths);
+
+    /**
+     * @brief Select the shortest Dubins word between two poses.
+     * 
+     * @param[out] lengths The normalized lengths of the three segments of the shortest word.
+     * 
+     * @return The index of the shortest word in DubinsWords.
+     */
+    static int ShortestDubinsWord(Eigen::Vector3d const& startPoint, double startHeading, Eigen::Vector3d const& endPoint, 
+                                double endHeading, double radius, std::array<double, 3>& lengths);
+
+    /**
+     * @brief Dubins words: L (left turn), R (right turn), S (straight line).
+     */
+    static constexpr const char* DubinsWords[6] {"LSL", "RSR", "LSR", "RSL", "RLR", "LRL"};
+
+    /**
+     * @brief Build the rounded corners of the polygon vertices (in parallel when OpenMP is enabled) and link them 
+     *        with straight lines. For a closed polygon the first corner is also the last one.
+     */
+    static std::shared_ptr<Path> RoundCorners(std::vector<Eigen::Vector3d> const& points, double radius, double transitionLength, 
+        bool closed);
+
 };
 
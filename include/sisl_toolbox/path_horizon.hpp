@@ -0,0 +1,122 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <eigen3/Eigen/Dense>
+
+#include "sisl_toolbox/path_view.hpp"
+
+class Path;
+
+/**
+ * @class PathHorizon
+ *
+ * @brief Receding horizon over a mission Path: it tracks the abscissa s of the vehicle and exposes only [s, s + horizon]
+ *        to the queries. The curves around the window live in a small local Path (sharing the curve objects with the
+ *        mission, nothing is copied): the curves behind the vehicle leave it, the curves ahead enter it up to a lookahead
+ *        margin beyond the horizon, so that their acceleration data (length index, segments of the straight lines) are
+ *        built before the vehicle needs them. The per query cost and the working set of the acceleration structures are
+ *        bounded by the horizon, not by the mission. Optionally the consumed curves are also released from the mission
+ *        path, in batches (amortized constant cost per curve), so that their memory is freed once nobody else holds them.
+ *        All the abscissae are mission abscissae, in [0, MissionLength()], also after the release of the consumed curves.
+ */
+class PathHorizon {
+
+public:
+
+    /**
+     * @brief PathHorizon constructor. The vehicle starts at the mission start. Throw an exception if the mission is null
+     *        or empty, the horizon is not positive or the lookahead is negative.
+     *
+     * @param[in] mission Mission path.
+     * @param[in] horizon_m Length of the window ahead of the vehicle.
+     * @param[in] lookahead_m Margin beyond the horizon loaded in advance.
+     * @param[in] releaseConsumed If true, the consumed curves are erased from the front of the mission path (whose
+     *            parametrization then restarts from the first remaining curve).
+     */
+    PathHorizon(std::shared_ptr<Path> mission, double horizon_m, double lookahead_m = 0, bool releaseConsumed = false);
+
+    /**
+     * @brief Move the vehicle to a mission abscissa and slide the window. Throw an exception if the abscissa is before the
+     *        window (released data) or beyond the mission end.
+     */
+    void Advance(double abscissa_m);
+
+    /**
+     * @brief Move the vehicle to the closest point of a position on the window (never backwards).
+     *
+     * @param[in] worldF_position Position of the vehicle.
+     *
+     * @return The new abscissa of the vehicle.
+     */
+    double Track(Eigen::Vector3d& worldF_position);
+
+    /**
+     * @brief Point at a mission abscissa. Throw an exception if the abscissa is out of the window.
+     */
+    Eigen::Vector3d At(double abscissa_m);
+
+    /**
+     * @brief Derivatives up to the n-th one at a mission abscissa (see Path::Derivate). Throw an exception if the abscissa
+     *        is out of the window.
+     */
+    std::vector<Eigen::Vector3d> Derivate(int order, double abscissa_m);
+
+    /**
+     * @brief Curvature at a mission abscissa. Throw an exception if the abscissa is out of the window.
+     */
+    double Curvature(double abscissa_m);
+
+    /**
+     * @brief Find the closest point on the window.
+     *
+     * @param[in] worldF_position Point in the find closest point problem.
+     * @param[out] abscissa_m Mission abscissa of the closest point.
+     *
+     * @return An Eigen::Vector3d representing the closest point.
+     */
+    Eigen::Vector3d FindClosestPoint(Eigen::Vector3d& worldF_position, double& abscissa_m);
+
+    /**
+     * @brief The window as a PathView on the local path (view abscissa 0 at the vehicle).
+     */
+    PathView View() const;
+
+    /**
+     * @brief Mission abscissa of the end of the window: the vehicle abscissa plus the horizon, or the mission end.
+     */
+    double WindowEnd() const;
+
+    // Getters
+    auto Abscissa() const& {return abscissa_m_;}
+    auto Horizon() const& {return horizon_m_;}
+    auto Lookahead() const& {return lookahead_m_;}
+    auto MissionLength() const& {return missionLength_m_;}
+    auto LocalPath() const& {return window_;}
+    auto LocalPathStart() const& {return windowStart_m_;}
+
+private:
+
+    /**
+     * @brief Drop the curves behind the vehicle from the local path, load the curves ahead up to the horizon plus the
+     *        lookahead and release the consumed curves from the mission (if enabled).
+     */
+    void Slide();
+
+    /**
+     * @brief Local path abscissa of a mission abscissa in the window, with the range check.
+     */
+    double ToLocalAbscissa(double abscissa_m, char const* method) const;
+
+    static constexpr int minimumRelease_{64}; // Minimum batch of curves released from the mission
+
+    std::shared_ptr<Path> mission_;
+    std::shared_ptr<Path> window_;
+    double horizon_m_;
+    double lookahead_m_;
+    bool releaseConsumed_;
+    double abscissa_m_;
+    double windowStart_m_; // Mission abscissa of the local path start
+    double missionLength_m_;
+    int nextCurve_;        // Id (in the mission path) of the next curve to be loaded
+};
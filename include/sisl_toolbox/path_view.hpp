@@ -0,0 +1,96 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <eigen3/Eigen/Dense>
+
+class Path;
+
+/**
+ * @class PathView
+ *
+ * @brief Lightweight window [startAbscissa, endAbscissa] on a Path, for the queries restricted to a section of the path
+ *        without extracting it (Path::ExtractSection copies the SISL coefficients of the partial end curves). The view is
+ *        parametrized in meters with abscissa in [0, viewLength], as an extracted section, and each query is mapped into
+ *        the parent path: a windowed projection costs as much as an unrestricted one. The view keeps the parent path
+ *        alive but it does not follow its changes: a view is meant to be rebuilt (it only holds three values) after the
+ *        parent is edited.
+ */
+class PathView {
+
+public:
+
+    /**
+     * @brief PathView constructor. Throw an exception if the path is null or the window is out of its parametrization.
+     *
+     * @param[in] path Parent path.
+     * @param[in] startAbscissa_m Start of the window (abscissa of the parent path).
+     * @param[in] endAbscissa_m End of the window (abscissa of the parent path), not before startAbscissa_m.
+     */
+    PathView(std::shared_ptr<Path> path, double startAbscissa_m, double endAbscissa_m);
+
+    /**
+     * @brief Given an abscissa of the view return the corresponding point. Throw an exception if the abscissa is out of
+     *        [0, Length()].
+     */
+    Eigen::Vector3d At(double abscissa_m) const;
+
+    /**
+     * @brief Given an abscissa of the view return the derivatives up to the n-th one (see Path::Derivate).
+     */
+    std::vector<Eigen::Vector3d> Derivate(int order, double abscissa_m) const;
+
+    /**
+     * @brief Given an abscissa of the view return the curvature.
+     */
+    double Curvature(double abscissa_m) const;
+
+    /**
+     * @brief Find the closest point on the window.
+     *
+     * @param[in] worldF_position Point in the find closest point problem.
+     * @param[out] abscissa_m Abscissa of the closest point on the view.
+     *
+     * @return An Eigen::Vector3d representing the closest point.
+     */
+    Eigen::Vector3d FindClosestPoint(Eigen::Vector3d& worldF_position, double& abscissa_m) const;
+
+    Eigen::Vector3d FindClosestPoint(Eigen::Vector3d& worldF_position) const;
+
+    /**
+     * @brief Find the abscissa of the view of the closest point on the window.
+     */
+    double FindAbscissaClosestPoint(Eigen::Vector3d& worldF_position) const;
+
+    /**
+     * @brief Sampling the window. As in Path::Sampling the total points are equally distributed among the curves (here the
+     *        portions of the curves in the window), equally spaced in meters on each portion.
+     *
+     * @param samples number of samples.
+     *
+     * @return std::shared_ptr<std::vector<Eigen::Vector3d>> containing the points.
+     */
+    std::shared_ptr<std::vector<Eigen::Vector3d>> Sampling(int samples) const;
+
+    /**
+     * @brief Convert an abscissa of the view to the abscissa of the parent path.
+     */
+    double PathAbscissa(double abscissa_m) const { return startAbscissa_m_ + abscissa_m; }
+
+    // Getters
+    auto GetPath() const& {return path_;}
+    auto StartAbscissa() const& {return startAbscissa_m_;}
+    auto EndAbscissa() const& {return endAbscissa_m_;}
+    auto Length() const& {return endAbscissa_m_ - startAbscissa_m_;}
+
+private:
+
+    /**
+     * @brief Abscissa of the parent path of an abscissa of the view, with the range check.
+     */
+    double ToPathAbscissa(double abscissa_m, char const* method) const;
+
+    std::shared_ptr<Path> path_;
+    double startAbscissa_m_;
+    double endAbscissa_m_;
+};
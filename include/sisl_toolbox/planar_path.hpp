@@ -0,0 +1,208 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <eigen3/Eigen/Dense>
+
+class Path;
+class PathFactory;
+
+/**
+ * @class PlanarPath
+ *
+ * @brief Path engine for planar paths made of straight lines, circular arcs and clothoids. Each curve is a constant sharpness
+ *        segment (start point, start heading, signed curvature, curvature derivative, length) with Eigen::Vector2d storage,
+ *        evaluated in closed form without SISL: lines and arcs analytically, clothoids through the Fresnel integrals. The path
+ *        is parametrized in meters with abscissa in the interval [0, pathLength], as Path. A PlanarPath can be built from
+ *        a planar Path (all the curves on the same plane z = const) and converted back.
+ */
+class PlanarPath {
+
+public:
+
+    /**
+     * @brief Constant sharpness segment: straight line (null curvature and sharpness), circular arc (null sharpness) or clothoid.
+     */
+    struct Segment {
+        Eigen::Vector2d startPoint;
+        double startHeading; // Angle (in rad) of the tangent at the start point w.r.t. the x-axis
+        double curvature;    // Signed curvature at the start point (positive when turning counterclockwise)
+        double sharpness;    // Curvature derivative w.r.t. the arc length
+        double length;
+
+        EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+    };
+
+    PlanarPath();
+
+    /**
+     * @brief Build the planar version of a path. The curves must be straight lines, circular arcs around an axis parallel to
+     *        z or clothoids, all on the same plane z = const. Otherwise an exception is thrown.
+     *
+     * @param[in] path The path to be converted.
+     */
+    PlanarPath(Path const& path);
+
+    /**
+     * @brief Convert to a Path (StraightLine, CircularArc and Clothoid objects) on the plane z = Elevation().
+     *
+     * @return std::shared_ptr<Path> containing the converted path.
+     */
+    std::shared_ptr<Path> ToPath() const;
+
+    /**
+     * @brief Add a straight line back. Zero length lines are skipped.
+     */
+    void AddLine(Eigen::Vector2d const& startPoint, Eigen::Vector2d const& endPoint);
+
+    /**
+     * @brief Add a circular arc back.
+     *
+     * @param[in] startPoint Start point of the arc.
+     * @param[in] startHeading Heading (in rad) of the tangent at the start point.
+     * @param[in] curvature Signed curvature (positive when turning counterclockwise), not null.
+     * @param[in] length Length of the arc.
+     */
+    void AddArc(Eigen::Vector2d const& startPoint, double startHeading, double curvature, double length);
+
+    /**
+     * @brief Add a clothoid back.
+     *
+     * @param[in] startPoint Start point of the clothoid.
+     * @param[in] startHeading Heading (in rad) of the tangent at the start point.
+     * @param[in] startCurvature Signed curvature at the start point.
+     * @param[in] endCurvature Signed curvature at the end point.
+     * @param[in] length Length of the clothoid.
+     */
+    void AddClothoid(Eigen::Vector2d const& startPoint, double startHeading, double startCurvature, double endCurvature, double length);
+
+    /**
+     * @brief Convert from Abscissa path parameter to abscissa on the segment (binary search on the segments start abscissae).
+     *        If the abscissa_m is out of [0, Length()], an exception is thrown.
+     *
+     * @param[in] abscissa_m Path abscissa value.
+     *
+     * @return A tuple containing respectively: abscissa on the segment, segment Id.
+     */
+    std::tuple<double, int> PathAbsToSegmentAbs(double abscissa_m) const;
+
+    /**
+     * @brief Given an abscissa return the corresponding point on path.
+     */
+    Eigen::Vector2d At(double abscissa_m) const;
+
+    /**
+     * @brief Given an abscissa return the heading (in rad, not wrapped) of the path tangent.
+     */
+    double Heading(double abscissa_m) const;
+
+    /**
+     * @brief Given an abscissa return the signed curvature (positive when turning counterclockwise).
+     */
+    double Curvature(double abscissa_m) const;
+
+    /**
+     * @brief Eval the planar tangent frame at the abscissa.
+     *
+     * @param[in] abscissa_m Abscissa on the path (in meters).
+     * @param[out] tangent Unit tangent.
+     * @param[out] normal Unit normal, on the left w.r.t. the direction of travel as for Path::EvalTangentFrame.
+     */
+    void EvalTangentFrame(double abscissa_m, Eigen::Vector2d& tangent, Eigen::Vector2d& normal) const;
+
+    /**
+     * @brief Sampling the path with samples equally spaced in abscissa.
+     *
+     * @param samples number of samples (at least 2).
+     *
+     * @return std::shared_ptr<std::vector<Eigen::Vector2d>> containing the points.
+     */
+    std::shared_ptr<std::vector<Eigen::Vector2d>> Sampling(int samples) const;
+
+    /**
+     * @brief Find Closest Point w.r.t. the path: analytic projection on lines and arcs, Newton iteration on clothoids.
+     *
+     * @param[in] position point in the find closest point problem.
+     * @param[out] segmentId Id of the segment containing the closest point.
+     * @param[out] abscissa_m Abscissa (in meters) of the closest point on the path.
+     *
+     * @return An Eigen::Vector2d representing the closest point.
+     */
+    Eigen::Vector2d FindClosestPoint(Eigen::Vector2d const& position, int& segmentId, double& abscissa_m) const;
+
+    /**
+     * @brief Find Abscissa of the Closest Point w.r.t. the path.
+     */
+    double FindAbscissaClosestPoint(Eigen::Vector2d const& position) const;
+
+    /**
+     * @brief Eval intersections among two planar paths: in closed form among lines and arcs, on chords refined with a Newton
+     *        iteration when a clothoid is involved.
+     *
+     * @param[in] otherPath The other path.
+     *
+     * @return std::vector<Eigen::Vector2d> contaning the intersection points.
+     */
+    std::vector<Eigen::Vector2d> Intersection(PlanarPath const& otherPath) const;
+
+    /**
+     * @brief Position on a segment.
+     */
+    static Eigen::Vector2d SegmentAt(Segment const& segment, double abscissa_m);
+
+    friend std::ostream& operator<< (std::ostream& os, const PlanarPath& obj) {
+        return os
+            << "Planar path name: " << obj.name_
+            << " | Length: " << obj.startAbscissae_.back()
+            << " | Segments contained: " << obj.segments_.size();
+    };
+
+    // Getters
+    auto const& Segments() const& {return segments_;}
+    auto SegmentsNumber() const& {return static_cast<int>(segments_.size());}
+    auto Length() const& {return startAbscissae_.back();}
+    auto Elevation() const& {return elevation_;}
+    auto Name() const& {return name_;}
+    Eigen::Vector2d EndPoint() const { return segments_.empty() ? Eigen::Vector2d::Zero() : SegmentAt(segments_.back(), segments_.back().length); }
+    double EndHeading() const { return segments_.empty() ? 0 : SegmentHeading(segments_.back(), segments_.back().length); }
+
+    // Setters
+    void SetElevation(double elevation) { elevation_ = elevation; }
+
+private:
+
+    friend PathFactory;
+
+    void AddSegment(Segment const& segment);
+
+    static double SegmentHeading(Segment const& segment, double abscissa_m) {
+        return segment.startHeading + abscissa_m * (segment.curvature + 0.5 * segment.sharpness * abscissa_m);
+    }
+
+    /**
+     * @brief Closest point on a segment.
+     *
+     * @return A tuple containing respectively: abscissa on the segment, distance.
+     */
+    static std::tuple<double, double> SegmentClosestPoint(Segment const& segment, Eigen::Vector2d const& position);
+
+    /**
+     * @brief Intersections among two segments.
+     *
+     * @return The pairs of abscissae (first segment, second segment) of the intersection points.
+     */
+    static std::vector<std::tuple<double, double>> SegmentIntersections(Segment const& first, Segment const& second);
+
+    /**
+     * @brief Abscissa of a point lying on the circle of an arc, -1 if it is out of the arc.
+     */
+    static double ArcAbscissa(Segment const& arc, Eigen::Vector2d const& point, double tolerance);
+
+    std::vector<Segment, Eigen::aligned_allocator<Segment>> segments_;
+    std::vector<double> startAbscissae_; // Path abscissa of the start of each segment, plus the path length
+    double elevation_{0};
+    std::string name_{};
+};
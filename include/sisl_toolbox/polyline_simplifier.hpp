@@ -0,0 +1,82 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <eigen3/Eigen/Dense>
+
+class Path;
+
+/**
+ * @class PolylineSimplifier
+ *
+ * @brief Abstract class used to reduce the sampled points of a Curve or a Path (e.g. for telemetry and displays). The buffer 
+ *        can be split in independent chunks (e.g. at the curve boundaries of the source Path), whose points are always kept 
+ *        and which are simplified in parallel when OpenMP is enabled.
+ */
+class PolylineSimplifier {
+
+    public:
+
+        /**
+         * @brief Douglas-Peucker simplification with an explicit stack (no recursion): the kept points are the ones farther 
+         *        than tolerance from the chord of the current interval. O(n log n) on average.
+         * 
+         * @param[in] points Shared ptr of vector of Eigen::Vector3d containing the points to simplify.
+         * @param[in] tolerance Maximum distance between the removed points and the simplified polyline.
+         * @param[in] breaks Indices of the points splitting the buffer in independent chunks (always kept) -> default = none
+         * 
+         * @return Shared ptr of vector of Eigen::Vector3d containing the kept points.
+         */
+        static std::shared_ptr<std::vector<Eigen::Vector3d>> DouglasPeucker(std::shared_ptr<std::vector<Eigen::Vector3d>> points, 
+            double tolerance, std::vector<std::size_t> const& breaks = {});
+
+        /**
+         * @brief Visvalingam-Whyatt simplification with a min heap: the point spanning the smallest triangle with its neighbours 
+         *        is removed until all the triangles are larger than areaTolerance. O(n log n).
+         * 
+         * @param[in] points Shared ptr of vector of Eigen::Vector3d containing the points to simplify.
+         * @param[in] areaTolerance Minimum effective area (in square meters) of the kept points.
+         * @param[in] breaks Indices of the points splitting the buffer in independent chunks (always kept) -> default = none
+         * 
+         * @return Shared ptr of vector of Eigen::Vector3d containing the kept points.
+         */
+        static std::shared_ptr<std::vector<Eigen::Vector3d>> Visvalingam(std::shared_ptr<std::vector<Eigen::Vector3d>> points, 
+            double areaTolerance, std::vector<std::size_t> const& breaks = {});
+
+        /**
+         * @brief Sample each curve of the path and simplify it with Douglas-Peucker, the curves being processed in parallel. 
+         *        The curve junctions are always kept.
+         * 
+         * @param[in] path The path to sample.
+         * @param[in] samples Number of samples, equally distributed among the curves as in Path::Sampling.
+         * @param[in] tolerance Maximum distance between the removed points and the simplified polyline.
+         * 
+         * @return Shared ptr of vector of Eigen::Vector3d containing the kept points.
+         */
+        static std::shared_ptr<std::vector<Eigen::Vector3d>> SimplifiedSampling(std::shared_ptr<Path> path, int samples, 
+            double tolerance);
+
+    private:
+
+        /**
+         * @brief Douglas-Peucker on the points [first, last], marking the kept points in keep (last excluded).
+         */
+        static void DouglasPeuckerChunk(std::vector<Eigen::Vector3d> const& points, std::size_t first, std::size_t last, 
+            double tolerance, std::vector<char>& keep);
+
+        /**
+         * @brief Visvalingam-Whyatt on the points [first, last], marking the kept points in keep (last excluded).
+         */
+        static void VisvalingamChunk(std::vector<Eigen::Vector3d> const& points, std::size_t first, std::size_t last, 
+            double areaTolerance, std::vector<char>& keep);
+
+        /**
+         * @brief Chunk boundaries: 0, the valid breaks in increasing order, points number - 1.
+         */
+        static std::vector<std::size_t> Chunks(std::size_t pointsNumber, std::vector<std::size_t> const& breaks);
+
+        /**
+         * @brief Distance between a point and the segment [start, end].
+         */
+        static double DistanceFromSegment(Eigen::Vector3d const& point, Eigen::Vector3d const& start, Eigen::Vector3d const& end);
+};
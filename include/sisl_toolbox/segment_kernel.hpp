@@ -0,0 +1,119 @@
+#pragma once
+
+#include <memory>
+#include <tuple>
+#include <vector>
+#include <eigen3/Eigen/Dense>
+
+class Curve;
+
+/**
+ * @class SegmentKernel
+ *
+ * @brief Batch point to segment distance evaluator for the straight lines of a path. The segments are stored as structure
+ *        of arrays (start point, direction, inverse squared length) so that the clamped projections are evaluated for 4
+ *        segments per instruction with AVX2 or 2 with NEON, with a scalar fallback when neither is enabled at compile time.
+ *        It also keeps the bookkeeping needed by Path to mix the segments with the other curves: the curve of each segment,
+ *        the first segment of each curve, the number of non line curves before each curve and the path abscissa of each
+ *        curve. A change of the path curves is applied incrementally (see Splice): only the segments of the new curves are
+ *        computed, the others are moved and their bookkeeping shifted.
+ */
+class SegmentKernel {
+
+public:
+
+    /**
+     * @brief Build the kernel from the curves of a path. Only the StraightLine objects with non null length become segments,
+     *        the other curves are only counted.
+     *
+     * @param[in] curves Curves of the path, in the path order.
+     */
+    SegmentKernel(std::vector<std::shared_ptr<Curve>> const& curves);
+
+    /**
+     * @brief Update the kernel after the curves in [firstCurve, firstCurve + erasedCurves) of the path have been replaced by
+     *        insertedCurves curves. Throw an exception if the ranges are out of bound.
+     *
+     * @param[in] curves Curves of the path after the change, in the path order.
+     * @param[in] firstCurve Id of the first changed curve.
+     * @param[in] erasedCurves Number of curves removed from the path.
+     * @param[in] insertedCurves Number of curves inserted in the path, starting from firstCurve in curves.
+     */
+    void Splice(std::vector<std::shared_ptr<Curve>> const& curves, int firstCurve, int erasedCurves, int insertedCurves);
+
+    /**
+     * @brief Find the segment closest to a point among the segments in [firstSegment, lastSegment).
+     *
+     * @param[in] worldF_position Point in the find closest point problem.
+     * @param[in] firstSegment First segment of the search.
+     * @param[in] lastSegment One past the last segment of the search.
+     *
+     * @return A tuple containing respectively: segment id (-1 if the range is empty), normalized projection parameter in
+     *         [0, 1], distance.
+     */
+    std::tuple<int, double, double> FindClosestSegment(Eigen::Vector3d const& worldF_position, int firstSegment, int lastSegment) const;
+
+    /**
+     * @brief Clamped projection of a point on a portion of a segment.
+     *
+     * @param[in] segmentId Id of the segment.
+     * @param[in] worldF_position Point to be projected.
+     * @param[in] tMin Normalized parameter of the start of the portion.
+     * @param[in] tMax Normalized parameter of the end of the portion.
+     *
+     * @return A tuple containing respectively: normalized projection parameter in [tMin, tMax], distance.
+     */
+    std::tuple<double, double> Project(int segmentId, Eigen::Vector3d const& worldF_position, double tMin = 0, double tMax = 1) const;
+
+    /**
+     * @brief Point on a segment given the normalized parameter.
+     */
+    Eigen::Vector3d Point(int segmentId, double t) const {
+        return Eigen::Vector3d{startX_[segmentId] + t * directionX_[segmentId], startY_[segmentId] + t * directionY_[segmentId],
+            startZ_[segmentId] + t * directionZ_[segmentId]};
+    }
+
+    /**
+     * @brief Check whether all the curves in [firstCurve, lastCurve] are straight lines.
+     */
+    bool AllLines(int firstCurve, int lastCurve) const { return otherCurvesBefore_[lastCurve + 1] == otherCurvesBefore_[firstCurve]; }
+
+    // Getters
+    auto SegmentsNumber() const& {return static_cast<int>(curveId_.size());}
+    auto CurvesNumber() const& {return static_cast<int>(firstSegment_.size()) - 1;}
+    auto CurveId(int segmentId) const& {return curveId_[segmentId];}
+    auto Length(int segmentId) const& {return length_[segmentId];}
+    auto FirstSegment(int curveId) const& {return firstSegment_[curveId];}
+    auto CurveStartAbscissa(int curveId) const& {return curveStartAbscissa_[curveId];}
+
+private:
+
+    SegmentKernel() = default;
+
+    /**
+     * @brief Append the bookkeeping of a curve (and its segment, if it is a straight line with non null length).
+     */
+    void AppendCurve(std::shared_ptr<Curve> const& curve, int curveId);
+
+    /**
+     * @brief Replace the elements in [first, first + erased) of target with the elements of source from sourceFirst on.
+     */
+    template <typename T>
+    static void SpliceArray(std::vector<T>& target, int first, int erased, std::vector<T> const& source, int sourceFirst);
+
+    // Segments (structure of arrays)
+    std::vector<double> startX_;
+    std::vector<double> startY_;
+    std::vector<double> startZ_;
+    std::vector<double> directionX_; // End point minus start point
+    std::vector<double> directionY_;
+    std::vector<double> directionZ_;
+    std::vector<double> inverseSquaredLength_;
+    std::vector<double> length_;
+    std::vector<int> curveId_;
+
+    // Curves bookkeeping (size: curves number + 1)
+    std::vector<int> firstSegment_;
+    std::vector<int> otherCurvesBefore_;
+    std::vector<double> curveStartAbscissa_;
+};
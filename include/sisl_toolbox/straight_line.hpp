@@ -21,6 +21,18 @@ public:
      * @param order Parameter used in Curve constructor -> default = 3
      */
     StraightLine(Eigen::Vector3d startPoint, Eigen::Vector3d endPoint, int dimension = 3, int order = 3);
+
+    /**
+    * @brief Exact offset of the straight line: the line is translated along its normal on the xy plane.
+    *
+    * @param[in] distance Signed offset distance (positive on the left w.r.t. the direction of travel).
+    * @param[in] tolerance Not used, the offset is exact.
+    *
+    * @return A shared ptr to the translated StraightLine.
+    */
+    std::shared_ptr<Curve> Offset(double distance, double tolerance = 0.001) override;
+
+    std::shared_ptr<Curve> Clone() const override {return CloneAs<StraightLine>();}
     
 
 private:    
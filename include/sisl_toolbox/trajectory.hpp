@@ -0,0 +1,111 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <vector>
+#include <eigen3/Eigen/Dense>
+
+class Path;
+
+/**
+ * @class Trajectory
+ *
+ * @brief Time parametrization of a Path. The velocity profile is time optimal w.r.t. the maximum speed, the maximum lateral 
+ *        acceleration (speed limited by the curvature) and the maximum longitudinal acceleration. It is computed with a forward 
+ *        and a backward pass over the curvature sampled on a uniform abscissa grid, so the solve is linear in the number of 
+ *        samples. Between two samples the acceleration is constant. The sharp corners between two curves (tangent jump) 
+ *        are handled as a curvature equal to the turning angle over the step.
+ */
+class Trajectory {
+
+public:
+
+    /**
+     * @brief Trajectory constructor. Throw an exception if the path is empty or if a limit is not positive.
+     *
+     * @param[in] path Path to be time parametrized.
+     * @param[in] maxSpeed Maximum speed (m/s).
+     * @param[in] maxLateralAcceleration Maximum lateral acceleration (m/s^2), i.e. speed^2 * curvature.
+     * @param[in] maxLongitudinalAcceleration Maximum acceleration and deceleration along the path (m/s^2).
+     * @param[in] step Abscissa step (in meters) of the curvature sampling, reduced to half the path length on the short 
+     *                 paths (at least 3 samples, so that the profile can start and end at rest).
+     * @param[in] startSpeed Speed at the path start -> default = 0
+     * @param[in] endSpeed Speed at the path end -> default = 0
+     */
+    Trajectory(std::shared_ptr<Path> path, double maxSpeed, double maxLateralAcceleration, double maxLongitudinalAcceleration,
+        double step, double startSpeed = 0, double endSpeed = 0);
+
+    /**
+     * @brief Given a time return the corresponding path abscissa s(t). The time is clamped on [0, Duration()].
+     * 
+     * @param[in] time Time (in seconds) from the path start.
+     *  
+     * @return The path abscissa (in meters).
+     */
+    double AbscissaAt(double time) const;
+
+    /**
+     * @brief Given a time return the speed along the path. The time is clamped on [0, Duration()].
+     * 
+     * @param[in] time Time (in seconds) from the path start.
+     *  
+     * @return The speed (m/s).
+     */
+    double SpeedAt(double time) const;
+
+    /**
+     * @brief Given a time return the longitudinal acceleration. The time is clamped on [0, Duration()].
+     * 
+     * @param[in] time Time (in seconds) from the path start.
+     *  
+     * @return The longitudinal acceleration (m/s^2).
+     */
+    double AccelerationAt(double time) const;
+
+    /**
+     * @brief Given a path abscissa return the speed of the profile. The abscissa is clamped on the path interval.
+     * 
+     * @param[in] abscissa_m Path abscissa (in meters).
+     *  
+     * @return The speed (m/s).
+     */
+    double SpeedAtAbscissa(double abscissa_m) const;
+
+    /**
+     * @brief Given a time return the corresponding point on path.
+     * 
+     * @param[in] time Time (in seconds) from the path start.
+     *  
+     * @return Eigen::Vector3d containing the point at time.
+     */
+    Eigen::Vector3d At(double time) const;
+
+    friend std::ostream& operator<< (std::ostream& os, const Trajectory& obj) {
+        return os 
+            << "Trajectory | Length: " << (obj.abscissae_.back() - obj.abscissae_.front())
+            << " | Duration: " << obj.times_.back()
+            << " | Samples: " << obj.abscissae_.size();
+    };
+
+    // Getters
+    auto GetPath() const& {return path_;}
+    auto Duration() const& {return times_.back();}
+    auto Abscissae() const& {return abscissae_;}
+    auto Speeds() const& {return speeds_;}
+    auto Times() const& {return times_;}
+
+private:
+
+    /**
+     * @brief Index of the sample interval [times_[i], times_[i + 1]] containing the time (already clamped).
+     */
+    std::size_t IntervalAt(double time) const;
+
+    std::shared_ptr<Path> path_;
+    double step_;
+    double timeStep_;
+    std::vector<double> abscissae_;
+    std::vector<double> speeds_;
+    std::vector<double> times_;
+    std::vector<std::size_t> timeIndex_; // First interval of each cell of the uniform time grid
+};
@@ -11,4 +11,11 @@
 #include "sisl_toolbox/persistence_manager.hpp"
 #include "sisl_toolbox/straight_line.hpp"
 #include "sisl_toolbox/circular_arc.hpp"
+#include "sisl_toolbox/clothoid.hpp"
 #include "sisl_toolbox/path.hpp"
+#include "sisl_toolbox/path_view.hpp"
+#include "sisl_toolbox/path_horizon.hpp"
+#include "sisl_toolbox/planar_path.hpp"
+#include "sisl_toolbox/frame_table.hpp"
+#include "sisl_toolbox/path_profile.hpp"
+#include "sisl_toolbox/trajectory.hpp"
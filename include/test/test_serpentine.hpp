@@ -10,10 +10,15 @@
 #include "sisl_toolbox/straight_line.hpp"
 #include "sisl_toolbox/circular_arc.hpp"
 #include "sisl_toolbox/path.hpp"
+#include "sisl_toolbox/composite_path.hpp"
+#include "sisl_toolbox/coverage_planner.hpp"
+#include "sisl_toolbox/trajectory.hpp"
 
 #include "sisl_toolbox/path_factory.hpp"
+#include "sisl_toolbox/geodetic_frame.hpp"
 
 #include "sisl_toolbox/persistence_manager.hpp"
+#include "sisl_toolbox/polyline_simplifier.hpp"
 
 
 
@@ -1,4 +1,5 @@
 #include "sisl_toolbox/circular_arc.hpp"
+#include "sisl_toolbox/geometry.hpp"
 #include "sisl.h"
 
 CircularArc::CircularArc(double angle, Eigen::Vector3d axis, Eigen::Vector3d startPoint, Eigen::Vector3d centrePoint, int dimension, int order) 
@@ -12,6 +13,7 @@ CircularArc::CircularArc(double angle, Eigen::Vector3d axis, Eigen::Vector3d sta
 
         // Generate a circle according to the parameters (angle, axis, startPoint, centrePoint).
         s1303(&startPoint[0], Epsge(), angle_, &centrePoint_[0], &axis_[0], Dimension(), &curve_, &statusFlag_);
+        BindKernel();
 
         // Pick parameters range of the curve.
         s1363(curve_, &startParameter_s_, &endParameter_s_, &statusFlag_);
@@ -29,6 +31,63 @@ CircularArc::CircularArc(double angle, Eigen::Vector3d axis, Eigen::Vector3d sta
 
         startParameter_m_ = startParameter_s_ * (length_ / (endParameter_s_ - startParameter_s_));
         endParameter_m_ = endParameter_s_ * (length_ / (endParameter_s_ - startParameter_s_));
-        
+
+        CacheEndpointData();
     }
 
+
+void CircularArc::Reverse()
+{
+    // The angle is updated first: the bounding box is evaluated again by Curve::Reverse.
+    angle_ = -angle_;
+
+    Curve::Reverse();
+}
+
+
+void CircularArc::EvalBoundingBox(Eigen::Vector3d& boxMin, Eigen::Vector3d& boxMax)
+{
+    boxMin = startPoint_.cwiseMin(endPoint_);
+    boxMax = startPoint_.cwiseMax(endPoint_);
+
+    // Arc points: centre + u * cos(theta) + v * sin(theta), with theta from 0 to angle_ around the axis.
+    const Eigen::Vector3d u{startPoint_ - centrePoint_};
+    const Eigen::Vector3d v{axis_.normalized().cross(u)};
+    const bool fullCircle{std::abs(angle_) >= 2 * M_PI};
+
+    // Each coordinate is extreme where its derivative (-u sin(theta) + v cos(theta)) vanishes.
+    for(int k = 0; k < 3; ++k) {
+        const double extremeAngle{std::atan2(v[k], u[k])};
+        for(double theta: {extremeAngle, extremeAngle + M_PI}) {
+            theta = Geometry::ConvertToRadInterval(theta);
+            if(angle_ < 0)
+                theta -= 2 * M_PI;
+            if(fullCircle or (angle_ >= 0 ? theta <= angle_ : theta >= angle_)) {
+                const Eigen::Vector3d point{centrePoint_ + u * std::cos(theta) + v * std::sin(theta)};
+                boxMin = boxMin.cwiseMin(point);
+                boxMax = boxMax.cwiseMax(point);
+            }
+        }
+    }
+}
+
+
+std::shared_ptr<Curve> CircularArc::Offset(double distance, double tolerance)
+{
+    Eigen::Vector3d unitAxis{axis_.normalized()};
+
+    if(std::abs(std::abs(unitAxis[2]) - 1) > 1e-9)
+        return Curve::Offset(distance, tolerance);
+
+    // The centre is on the left of the direction of travel when the arc turns counterclockwise (w.r.t. the z-axis).
+    double turn{(angle_ * unitAxis[2] > 0) ? 1.0 : -1.0};
+    double radius{(startPoint_ - centrePoint_).norm()};
+    double offsetRadius{radius - turn * distance};
+
+    if(offsetRadius <= tolerance)
+        return nullptr;
+
+    Eigen::Vector3d offsetStartPoint{centrePoint_ + (startPoint_ - centrePoint_) * (offsetRadius / radius)};
+    
+    return std::make_shared<CircularArc>(angle_, axis_, offsetStartPoint, centrePoint_, Dimension(), Order());
+}
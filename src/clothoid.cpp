@@ -0,0 +1,628 @@
+#include "sisl_toolbox/clothoid.hpp"
+#include "sisl_toolbox/straight_line.hpp"
+#include "sisl_toolbox/geometry.hpp"
+#include "sisl.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <complex>
+#include <limits>
+#include <algorithm>
+
+
+Clothoid::Clothoid(Eigen::Vector3d startPoint, double startHeading, double startCurvature, double endCurvature, double length,
+    int dimension, int order)
+    : Curve(dimension, order)
+    , startHeading_{startHeading}
+    , startCurvature_{startCurvature}
+    , endCurvature_{endCurvature}
+    {
+        name_ = "Clothoid";
+
+        if(length <= 0)
+            throw std::runtime_error("[Clothoid::Clothoid] Input parameter error. length must be positive");
+
+        statusFlag_ = 0;
+        length_ = length;
+        sharpness_ = (endCurvature_ - startCurvature_) / length_;
+
+        // The Sisl parametrization is not defined: both parametrizations coincide with the arc length.
+        startParameter_s_ = 0;
+        endParameter_s_ = length_;
+        startParameter_m_ = 0;
+        endParameter_m_ = length_;
+
+        startPoint_ = startPoint;
+        endPoint_ = Position(length_);
+
+        CacheEndpointData();
+    }
+
+
+void Clothoid::Fresnel(double x, double& C, double& S)
+{
+    const int maxIterations{100};
+    const double eps{std::numeric_limits<double>::epsilon()};
+    const double fpMin{std::numeric_limits<double>::min()};
+    const double absX{std::abs(x)};
+
+    if(absX < std::sqrt(fpMin)) {
+        C = absX;
+        S = 0;
+    }
+    else if(absX <= 1.5) {
+        // Power series, the terms of C and S are accumulated alternately.
+        double sum{0};
+        double sumS{0};
+        double sumC{absX};
+        double sign{1};
+        double factor{M_PI_2 * absX * absX};
+        double term{absX};
+        bool odd{true};
+        int n{3};
+
+        for(int k = 1; k <= maxIterations; ++k) {
+            term *= factor / k;
+            sum += sign * term / n;
+            double test{std::abs(sum) * eps};
+            if(odd) {
+                sign = -sign;
+                sumS = sum;
+                sum = sumC;
+            }
+            else {
+                sumC = sum;
+                sum = sumS;
+            }
+            if(term < test)
+                break;
+            odd = !odd;
+            n += 2;
+        }
+        C = sumC;
+        S = sumS;
+    }
+    else {
+        // Continued fraction of the complementary error function (modified Lentz method).
+        const double piX2{M_PI * absX * absX};
+        std::complex<double> b{1.0, -piX2};
+        std::complex<double> cc{1.0 / fpMin, 0.0};
+        std::complex<double> d{1.0 / b};
+        std::complex<double> h{d};
+        int n{-1};
+
+        for(int k = 2; k <= maxIterations; ++k) {
+            n += 2;
+            double a{-static_cast<double>(n * (n + 1))};
+            b += 4.0;
+            d = 1.0 / (a * d + b);
+            cc = b + a / cc;
+            std::complex<double> del{cc * d};
+            h *= del;
+            if(std::abs(del.real() - 1.0) + std::abs(del.imag()) < eps)
+                break;
+        }
+        h *= std::complex<double>{absX, -absX};
+        std::complex<double> cs{std::complex<double>{0.5, 0.5}
+            * (1.0 - std::complex<double>{std::cos(0.5 * piX2), std::sin(0.5 * piX2)} * h)};
+        C = cs.real();
+        S = cs.imag();
+    }
+
+    if(x < 0) {
+        C = -C;
+        S = -S;
+    }
+}
+
+
+void Clothoid::Integrate(double curvature, double sharpness, double abscissa_m, double& x, double& y)
+{
+    const double s{abscissa_m};
+
+    if(std::abs(sharpness) * s * s < 2e-3) {
+        // Nearly constant curvature: expand exp(i * sharpness * t^2 / 2) around the circular arc (or straight line) and
+        // integrate term by term using the moments M_m = int_0^s t^m exp(i * curvature * t) dt.
+        std::array<std::complex<double>, 9> moments{};
+        const std::complex<double> ik{0, curvature};
+
+        if(std::abs(curvature * s) < 1.0) {
+            for(int m = 0; m < 9; ++m) {
+                std::complex<double> sum{0};
+                std::complex<double> term{std::pow(s, m + 1)};
+                for(int j = 0; j < 30; ++j) {
+                    sum += term / static_cast<double>(m + j + 1);
+                    term *= ik * s / static_cast<double>(j + 1);
+                    if(std::abs(term) < 1e-18 * std::abs(sum))
+                        break;
+                }
+                moments[m] = sum;
+            }
+        }
+        else {
+            const std::complex<double> e{std::cos(curvature * s), std::sin(curvature * s)};
+            double sPow{1};
+            moments[0] = (e - 1.0) / ik;
+            for(int m = 1; m < 9; ++m) {
+                sPow *= s;
+                moments[m] = (sPow * e - static_cast<double>(m) * moments[m - 1]) / ik;
+            }
+        }
+
+        std::complex<double> sum{0};
+        std::complex<double> coefficient{1};
+        for(int n = 0; n <= 4; ++n) {
+            sum += coefficient * moments[2 * n];
+            coefficient *= std::complex<double>{0, sharpness / 2} / static_cast<double>(n + 1);
+        }
+        x = sum.real();
+        y = sum.imag();
+        return;
+    }
+
+    // Complete the square: curvature * t + sharpness * t^2 / 2 = sign * pi/2 * u^2 + phase.
+    const double sign{sharpness > 0 ? 1.0 : -1.0};
+    const double scale{std::sqrt(std::abs(sharpness) / M_PI)};
+    const double u0{scale * curvature / sharpness};
+    const double u1{scale * (s + curvature / sharpness)};
+    const double phase{-curvature * curvature / (2 * sharpness)};
+
+    double C0{}; double S0{}; double C1{}; double S1{};
+    Fresnel(u0, C0, S0);
+    Fresnel(u1, C1, S1);
+
+    std::complex<double> result{std::complex<double>{std::cos(phase), std::sin(phase)}
+        * std::complex<double>{C1 - C0, sign * (S1 - S0)} / scale};
+    x = result.real();
+    y = result.imag();
+}
+
+
+std::tuple<double, double> Clothoid::TransitionOffsets(double radius, double length)
+{
+    double x{}; double y{};
+    Integrate(0, 1 / (radius * length), length, x, y);
+
+    const double tau{length / (2 * radius)};
+
+    return std::make_tuple(x - radius * std::sin(tau), y - radius * (1 - std::cos(tau)));
+}
+
+
+Eigen::Vector3d Clothoid::Position(double abscissa_m) const
+{
+    double x{}; double y{};
+    Integrate(startCurvature_, sharpness_, abscissa_m, x, y);
+
+    const double cosHeading{std::cos(startHeading_)};
+    const double sinHeading{std::sin(startHeading_)};
+
+    return Eigen::Vector3d{startPoint_[0] + cosHeading * x - sinHeading * y,
+                           startPoint_[1] + sinHeading * x + cosHeading * y,
+                           startPoint_[2]};
+}
+
+
+void Clothoid::FromAbsSislToPos(double abscissa_s, Eigen::Vector3d& worldF_position)
+{
+    if(abscissa_s < startParameter_s_)
+        throw std::runtime_error("[Clothoid::FromAbsSislToPos] Input parameter error. abscissa_s before startParameter_s_");
+    else if (abscissa_s > endParameter_s_)
+        throw std::runtime_error("[Clothoid::FromAbsSislToPos] Input parameter error. abscissa_s beyond endParameter_s_");
+
+    worldF_position = Position(abscissa_s);
+}
+
+
+void Clothoid::FromAbsMetersToPos(double abscissa_m, Eigen::Vector3d& worldF_position)
+{
+    try {
+        MeterAbsToSislAbs(abscissa_m);
+    }
+    catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[Clothoid::FromAbsMetersToPos] -> ") + exception.what());
+    }
+
+    worldF_position = Position(abscissa_m);
+}
+
+
+Eigen::Vector3d Clothoid::At(double abscissa_m)
+{
+    try {
+        MeterAbsToSislAbs(abscissa_m);
+    } catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[Clothoid::At] -> ") + exception.what());
+    }
+
+    return Position(abscissa_m);
+}
+
+
+std::vector<Eigen::Vector3d> Clothoid::Derivate(int order, double abscissa_m)
+{
+    try {
+        MeterAbsToSislAbs(abscissa_m);
+    } catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[Clothoid::Derivate] -> ") + exception.what());
+    }
+
+    std::vector<Eigen::Vector3d> derivates{};
+
+    // The first derivative is exp(i * heading). The following ones are P_m(k) * exp(i * heading), where P_m is a polynomial
+    // in the curvature k with P_0 = 1 and P_(m+1) = sharpness * dP_m/dk + i * k * P_m.
+    const double k{SignedCurvature(abscissa_m)};
+    const std::complex<double> unitTangent{std::cos(Heading(abscissa_m)), std::sin(Heading(abscissa_m))};
+    std::vector<std::complex<double>> polynomial{1.0};
+
+    for(int i = 1; i <= order; ++i) {
+        std::complex<double> value{0};
+        for(auto it = polynomial.rbegin(); it != polynomial.rend(); ++it)
+            value = value * k + *it;
+        value *= unitTangent;
+        derivates.emplace_back(Eigen::Vector3d{value.real(), value.imag(), 0});
+
+        std::vector<std::complex<double>> next(polynomial.size() + 1, 0.0);
+        for(std::size_t j = 0; j < polynomial.size(); ++j) {
+            if(j > 0)
+                next[j - 1] += sharpness_ * static_cast<double>(j) * polynomial[j];
+            next[j + 1] += std::complex<double>{0, 1} * polynomial[j];
+        }
+        polynomial = next;
+    }
+
+    return derivates;
+}
+
+
+double Clothoid::Curvature(double abscissa_m)
+{
+    try {
+        MeterAbsToSislAbs(abscissa_m);
+    } catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[Clothoid::Curvature] -> ") + exception.what());
+    }
+
+    return std::abs(SignedCurvature(abscissa_m));
+}
+
+
+void Clothoid::Reverse()
+{
+    const double endHeading{Heading(length_)};
+    const double startCurvature{startCurvature_};
+
+    startHeading_ = endHeading + M_PI;
+    startCurvature_ = -endCurvature_;
+    endCurvature_ = -startCurvature;
+    sharpness_ = (endCurvature_ - startCurvature_) / length_;
+
+    std::swap(startPoint_, endPoint_);
+
+    CacheEndpointData();
+}
+
+
+void Clothoid::EvalBoundingBox(Eigen::Vector3d& boxMin, Eigen::Vector3d& boxMax)
+{
+    boxMin = startPoint_.cwiseMin(endPoint_);
+    boxMax = startPoint_.cwiseMax(endPoint_);
+
+    // The coordinates are extreme where the heading is a multiple of pi/2: the heading is quadratic in the abscissa, 
+    // its range on [0, length_] is bounded by the values at the ends and at the vertex of the parabola.
+    double minHeading{std::min(startHeading_, Heading(length_))};
+    double maxHeading{std::max(startHeading_, Heading(length_))};
+    if(sharpness_ != 0) {
+        const double vertex{-startCurvature_ / sharpness_};
+        if(vertex > 0 and vertex < length_) {
+            minHeading = std::min(minHeading, Heading(vertex));
+            maxHeading = std::max(maxHeading, Heading(vertex));
+        }
+    }
+
+    auto addPoint = [&](double abscissa_m) {
+        if(abscissa_m > 0 and abscissa_m < length_) {
+            const Eigen::Vector3d point{Position(abscissa_m)};
+            boxMin = boxMin.cwiseMin(point);
+            boxMax = boxMax.cwiseMax(point);
+        }
+    };
+
+    for(double k = std::ceil(minHeading / (M_PI / 2)); k <= std::floor(maxHeading / (M_PI / 2)); ++k) {
+        // Solve 0.5 * sharpness_ * s^2 + startCurvature_ * s + startHeading_ - k * pi / 2 = 0.
+        const double offset{startHeading_ - k * M_PI / 2};
+        if(sharpness_ == 0) {
+            if(startCurvature_ != 0)
+                addPoint(-offset / startCurvature_);
+            continue;
+        }
+        const double discriminant{startCurvature_ * startCurvature_ - 2 * sharpness_ * offset};
+        if(discriminant < 0)
+            continue;
+        addPoint((-startCurvature_ + std::sqrt(discriminant)) / sharpness_);
+        addPoint((-startCurvature_ - std::sqrt(discriminant)) / sharpness_);
+    }
+}
+
+
+std::shared_ptr<std::vector<Eigen::Vector3d>> Clothoid::Sampling(int const samples) const
+{
+    auto curve = std::make_shared<std::vector<Eigen::Vector3d>>();
+    curve->reserve(samples);
+
+    for (double k = 0; k < samples; ++k) {
+        curve->emplace_back(Position(k / (samples - 1) * length_));
+    }
+
+    return curve;
+}
+
+
+std::tuple<double, double> Clothoid::FindClosestPoint(Eigen::Vector3d& worldF_position)
+{
+    return FindClosestPointOnInterval(worldF_position, 0, length_);
+}
+
+
+std::tuple<double, double> Clothoid::FindClosestPointOnInterval(Eigen::Vector3d& worldF_position, double startValue_m, 
+    double endValue_m)
+{
+    if(startValue_m > endValue_m)
+        std::swap(startValue_m, endValue_m);
+    startValue_m = std::min(std::max(startValue_m, 0.0), length_);
+    endValue_m = std::min(std::max(endValue_m, 0.0), length_);
+    const double width{endValue_m - startValue_m};
+
+    if(width == 0)
+        return std::make_tuple(startValue_m, (Position(startValue_m) - worldF_position).norm());
+
+    // Coarse search on samples whose heading differs at most 0.25 rad, then refine with a safeguarded Newton iteration on
+    // f(s) = (P(s) - position) . T(s), the derivative of half the squared distance.
+    const double maxCurvature{std::max(std::abs(SignedCurvature(startValue_m)), std::abs(SignedCurvature(endValue_m)))};
+    double step{width / 16};
+    if(maxCurvature > 0)
+        step = std::min(step, 0.25 / maxCurvature);
+    const int samples{static_cast<int>(std::ceil(width / step))};
+    step = width / samples;
+
+    double bestAbscissa{startValue_m};
+    double bestDistance{std::numeric_limits<double>::max()};
+    for(int i = 0; i <= samples; ++i) {
+        double distance{(Position(startValue_m + i * step) - worldF_position).squaredNorm()};
+        if(distance < bestDistance) {
+            bestDistance = distance;
+            bestAbscissa = startValue_m + i * step;
+        }
+    }
+
+    auto f = [this, &worldF_position](double s) {
+        double heading{Heading(s)};
+        Eigen::Vector3d difference{Position(s) - worldF_position};
+        return difference[0] * std::cos(heading) + difference[1] * std::sin(heading);
+    };
+
+    double lower{std::max(startValue_m, bestAbscissa - step)};
+    double upper{std::min(endValue_m, bestAbscissa + step)};
+    double abscissa_m{bestAbscissa};
+
+    if(f(lower) >= 0) {
+        abscissa_m = lower;
+    }
+    else if(f(upper) <= 0) {
+        abscissa_m = upper;
+    }
+    else {
+        for(int i = 0; i < 50; ++i) {
+            double heading{Heading(abscissa_m)};
+            Eigen::Vector3d difference{Position(abscissa_m) - worldF_position};
+            double value{difference[0] * std::cos(heading) + difference[1] * std::sin(heading)};
+            double derivative{1 + SignedCurvature(abscissa_m) * (-difference[0] * std::sin(heading) + difference[1] * std::cos(heading))};
+
+            if(value < 0) lower = abscissa_m;
+            else upper = abscissa_m;
+
+            double next{(derivative > 0) ? abscissa_m - value / derivative : 0.5 * (lower + upper)};
+            if(next <= lower or next >= upper)
+                next = 0.5 * (lower + upper);
+
+            if(std::abs(next - abscissa_m) < 1e-12 * std::max(1.0, length_)) {
+                abscissa_m = next;
+                break;
+            }
+            abscissa_m = next;
+        }
+    }
+
+    return std::make_tuple(abscissa_m, (Position(abscissa_m) - worldF_position).norm());
+}
+
+
+std::shared_ptr<Curve> Clothoid::ExtractSection(double startValue_m, double endValue_m)
+{
+    try {
+        MeterAbsToSislAbs(startValue_m);
+        MeterAbsToSislAbs(endValue_m);
+    } catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string{"[Clothoid::ExtractSection] -> "} + exception.what());
+    }
+
+    std::shared_ptr<Clothoid> curveSection;
+    if(startValue_m <= endValue_m) {
+        curveSection = std::make_shared<Clothoid>(Position(startValue_m), Heading(startValue_m), SignedCurvature(startValue_m),
+            SignedCurvature(endValue_m), endValue_m - startValue_m, Dimension(), Order());
+    }
+    else {
+        curveSection = std::make_shared<Clothoid>(Position(endValue_m), Heading(endValue_m), SignedCurvature(endValue_m),
+            SignedCurvature(startValue_m), startValue_m - endValue_m, Dimension(), Order());
+        curveSection->Reverse();
+    }
+    curveSection->name_ = name_;
+
+    return curveSection;
+}
+
+
+std::shared_ptr<Curve> Clothoid::Offset(double distance, double tolerance)
+{
+    // The offset speed 1 - distance * k(s) is linear in s: keep the interval where it is positive.
+    const double minSpeed{1e-3};
+    const double startSpeed{1 - distance * startCurvature_};
+    const double endSpeed{1 - distance * endCurvature_};
+
+    if(startSpeed <= minSpeed and endSpeed <= minSpeed)
+        return nullptr;
+
+    double lower{0};
+    double upper{length_};
+    if(startSpeed <= minSpeed)
+        lower = (1 - minSpeed - distance * startCurvature_) / (distance * sharpness_);
+    if(endSpeed <= minSpeed)
+        upper = (1 - minSpeed - distance * startCurvature_) / (distance * sharpness_);
+
+    // Sampling step from the sagitta of the offset curve, whose curvature is k / (1 - distance * k).
+    double maxOffsetCurvature{std::max(std::abs(SignedCurvature(lower)) / (1 - distance * SignedCurvature(lower)),
+                                       std::abs(SignedCurvature(upper)) / (1 - distance * SignedCurvature(upper)))};
+    double step{(upper - lower) / 4};
+    if(maxOffsetCurvature > 0)
+        step = std::min(step, std::sqrt(8 * tolerance / maxOffsetCurvature));
+    const int samples{static_cast<int>(std::ceil((upper - lower) / step)) + 1};
+    step = (upper - lower) / (samples - 1);
+
+    std::vector<double> points{};
+    points.reserve(3 * samples);
+    for(int i = 0; i < samples; ++i) {
+        double abscissa_m{lower + i * step};
+        double heading{Heading(abscissa_m)};
+        Eigen::Vector3d point{Position(abscissa_m) + distance * Eigen::Vector3d{-std::sin(heading), std::cos(heading), 0}};
+        points.insert(points.end(), {point[0], point[1], point[2]});
+    }
+
+    std::vector<int> pointTypes(samples, 1); // Ordinary points
+    int startConditions{0};
+    int endConditions{0};
+    int open{1};
+    int order{4};
+    double startParameter{0};
+    double endParameter{0};
+    SISLCurve* offsetCurve{nullptr};
+    double* parameters{nullptr};
+    int parametersNumber{0};
+
+    s1356(&points[0], samples, 3, &pointTypes[0], startConditions, endConditions, open, order, startParameter, &endParameter,
+        &offsetCurve, &parameters, &parametersNumber, &statusFlag_);
+
+    if(parameters != nullptr)
+        std::free(parameters);
+
+    if(statusFlag_ < 0 or offsetCurve == nullptr)
+        throw std::runtime_error("[Clothoid::Offset] s1356 failed with status " + std::to_string(statusFlag_));
+
+    // The order of the interpolating spline is set by s1356, not by the clothoid.
+    return std::make_shared<Curve>(offsetCurve, offsetCurve->idim, offsetCurve->ik);
+}
+
+
+std::vector<Eigen::Vector3d> Clothoid::Intersection(std::shared_ptr<Curve> otherCurve)
+{
+    std::vector<Eigen::Vector3d> intersections{};
+    Eigen::Vector3d intersectionPoint;
+
+    if(otherCurve->Length() == 0 or not BoxesOverlap(*otherCurve, Epsge()))
+        return intersections;
+
+    // Chords with a sagitta lower than 1 cm are accurate enough to isolate the intersections.
+    const double maxCurvature{std::max(std::abs(startCurvature_), std::abs(endCurvature_))};
+    double step{length_};
+    if(maxCurvature > 0)
+        step = std::min(step, std::min(std::sqrt(8 * 1e-2 / maxCurvature), 0.2 / maxCurvature));
+    const int chords{static_cast<int>(std::ceil(length_ / step))};
+    step = length_ / chords;
+
+    // Conversion factor from the Sisl derivative to the in meters derivative of the other curve.
+    double otherScale{1};
+    if(otherCurve->Length() > 0)
+        otherScale = (otherCurve->EndParameter_s() - otherCurve->StartParameter_s()) / otherCurve->Length();
+    const double otherMin{std::min(otherCurve->StartParameter_m(), otherCurve->EndParameter_m())};
+    const double otherMax{std::max(otherCurve->StartParameter_m(), otherCurve->EndParameter_m())};
+
+    for(int i = 0; i < chords; ++i) {
+
+        auto chord = std::make_shared<StraightLine>(Position(i * step), Position((i + 1) * step), Dimension(), Order());
+
+        std::vector<Eigen::Vector3d> candidates{};
+        try {
+            candidates = chord->Intersection(otherCurve);
+        } catch(std::runtime_error const& exception) {
+            throw std::runtime_error(std::string("[Clothoid::Intersection] -> ") + exception.what());
+        }
+
+        for(auto& candidate: candidates) {
+
+            double abscissa_m{i * step + (candidate - chord->StartPoint()).norm()};
+            double otherAbscissa_m{0};
+            std::tie(otherAbscissa_m, std::ignore) = otherCurve->FindClosestPoint(candidate);
+
+            // Newton iteration on P(s) - Q(u) = 0 (planar components).
+            for(int k = 0; k < 10; ++k) {
+                Eigen::Vector3d residual{Position(abscissa_m) - otherCurve->At(otherAbscissa_m)};
+                if(residual.head<2>().norm() < 1e-9)
+                    break;
+
+                // Solve [T(s), -T'(u)] * [deltaS, deltaU] = -residual.
+                double heading{Heading(abscissa_m)};
+                Eigen::Vector3d otherTangent{otherCurve->Derivate(1, otherAbscissa_m)[0] * otherScale};
+                double determinant{otherTangent[0] * std::sin(heading) - otherTangent[1] * std::cos(heading)};
+                if(std::abs(determinant) < 1e-12)
+                    break;
+
+                double deltaS{(residual[0] * otherTangent[1] - residual[1] * otherTangent[0]) / determinant};
+                double deltaU{(residual[0] * std::sin(heading) - residual[1] * std::cos(heading)) / determinant};
+
+                abscissa_m = std::min(std::max(abscissa_m + deltaS, 0.0), length_);
+                otherAbscissa_m = std::min(std::max(otherAbscissa_m + deltaU, otherMin), otherMax);
+            }
+
+            // Adjacent chords may converge to the same intersection.
+            intersectionPoint = Position(abscissa_m);
+            Geometry::AddUniquePoint(intersections, intersectionPoint, MergeDistance());
+        }
+    }
+
+    return intersections;
+}
+
+
+void Clothoid::EvalTangentFrame(double abscissa_m, Eigen::Vector3d& tangent, Eigen::Vector3d& normal, Eigen::Vector3d& binormal)
+{
+    try {
+        MeterAbsToSislAbs(abscissa_m);
+    } catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[Clothoid::EvalTangentFrame] -> ") + exception.what());
+    }
+
+    double heading{Heading(abscissa_m)};
+    tangent = Eigen::Vector3d{std::cos(heading), std::sin(heading), 0};
+
+    normal = tangent.cross(-Eigen::Vector3d::UnitZ());
+    binormal = tangent.cross(normal);
+}
+
+
+void Clothoid::EvalFSFrame(double abscissa_s, Eigen::Vector3d& tangent, Eigen::Vector3d& normal, Eigen::Vector3d& binormal,
+                        Eigen::Vector3d& der_tan, Eigen::Vector3d& der_nor, Eigen::Vector3d& der_bin)
+{
+    double heading{Heading(abscissa_s)};
+    double signedCurvature{SignedCurvature(abscissa_s)};
+
+    // Planar curve: the principal normal points towards the centre of curvature and the torsion is null.
+    tangent = Eigen::Vector3d{std::cos(heading), std::sin(heading), 0};
+    normal = Eigen::Vector3d{-std::sin(heading), std::cos(heading), 0};
+    if(signedCurvature < 0)
+        normal = -normal;
+    binormal = tangent.cross(normal);
+
+    double k{std::abs(signedCurvature)};
+    der_tan = k * normal;
+    der_nor = -k * tangent;
+    der_bin = Eigen::Vector3d::Zero();
+}
@@ -0,0 +1,184 @@
+#include "sisl_toolbox/composite_path.hpp"
+
+#include "sisl_toolbox/path.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+
+void CompositePath::Append(std::shared_ptr<Path> path)
+{
+    if(path == nullptr)
+        throw std::runtime_error("[CompositePath::Append] Input parameter error. The path is null");
+    if(path->CurvesNumber() == 0)
+        throw std::runtime_error("[CompositePath::Append] Input parameter error. The path is empty");
+
+    parts_.push_back(path);
+    partLengths_.PushBack(path->Length());
+}
+
+
+void CompositePath::Append(CompositePath const& other)
+{
+    // Copies of the sub-paths and of their lengths when appending the composite path to itself
+    const std::vector<std::shared_ptr<Path>> parts{other.parts_};
+    std::vector<double> lengths;
+    lengths.reserve(parts.size());
+    for(int i = 0; i < other.PartsNumber(); ++i)
+        lengths.push_back(other.partLengths_.Length(i));
+
+    parts_.insert(parts_.end(), parts.begin(), parts.end());
+    partLengths_.Splice(partLengths_.Size(), 0, lengths);
+}
+
+
+void CompositePath::Refresh(int partId)
+{
+    if(partId < 0 or partId >= PartsNumber())
+        throw std::runtime_error("[CompositePath::Refresh] Input parameter error. partId out of bound");
+
+    partLengths_.Update(partId, parts_[partId]->Length());
+}
+
+
+std::tuple<double, int> CompositePath::PathAbsToPartAbs(double abscissa_m) const
+{
+    if(abscissa_m < 0)
+        throw std::runtime_error("[CompositePath::PathAbsToPartAbs] Input parameter error. abscissa_m before the start");
+    if(abscissa_m > Length())
+        throw std::runtime_error("[CompositePath::PathAbsToPartAbs] Input parameter error. abscissa_m beyond the end");
+
+    double abscissaPart_m{0};
+    const int partId{partLengths_.Find(abscissa_m, abscissaPart_m)};
+
+    if(partId < 0)
+        throw std::runtime_error("[CompositePath::PathAbsToPartAbs] The composite path is empty");
+
+    auto const& part = parts_[partId];
+
+    return std::make_tuple(std::min(std::max(part->StartParameter() + abscissaPart_m, part->StartParameter()),
+        part->EndParameter()), partId);
+}
+
+
+double CompositePath::PartAbsToPathAbs(double abscissaPart_m, int partId) const
+{
+    if(partId < 0 or partId >= PartsNumber())
+        throw std::runtime_error("[CompositePath::PartAbsToPathAbs] Input parameter error. partId out of bound");
+
+    return partLengths_.Prefix(partId) + abscissaPart_m - parts_[partId]->StartParameter();
+}
+
+
+Eigen::Vector3d CompositePath::At(double abscissa_m) const
+{
+    double abscissaPart_m{0};
+    int partId{0};
+
+    try {
+        std::tie(abscissaPart_m, partId) = PathAbsToPartAbs(abscissa_m);
+        return parts_[partId]->At(abscissaPart_m);
+    } catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[CompositePath::At] -> ") + exception.what());
+    }
+}
+
+
+std::vector<Eigen::Vector3d> CompositePath::Derivate(int order, double abscissa_m) const
+{
+    double abscissaPart_m{0};
+    int partId{0};
+
+    try {
+        std::tie(abscissaPart_m, partId) = PathAbsToPartAbs(abscissa_m);
+        return parts_[partId]->Derivate(order, abscissaPart_m);
+    } catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[CompositePath::Derivate] -> ") + exception.what());
+    }
+}
+
+
+double CompositePath::Curvature(double abscissa_m) const
+{
+    double abscissaPart_m{0};
+    int partId{0};
+
+    try {
+        std::tie(abscissaPart_m, partId) = PathAbsToPartAbs(abscissa_m);
+        return parts_[partId]->Curvature(abscissaPart_m);
+    } catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[CompositePath::Curvature] -> ") + exception.what());
+    }
+}
+
+
+Eigen::Vector3d CompositePath::FindClosestPoint(Eigen::Vector3d& worldF_position, double& abscissa_m) const
+{
+    if(parts_.empty())
+        throw std::runtime_error("[CompositePath::FindClosestPoint] The composite path is empty");
+
+    Eigen::Vector3d closestPoint{};
+    double minDistance{std::numeric_limits<double>::max()};
+
+    try {
+        for(int i = 0; i < PartsNumber(); ++i) {
+            int curveId{0};
+            double abscissaCurve_m{0};
+            const Eigen::Vector3d point{parts_[i]->FindClosestPoint(worldF_position, curveId, abscissaCurve_m)};
+            const double distance{(point - worldF_position).norm()};
+
+            if(distance < minDistance) {
+                minDistance = distance;
+                closestPoint = point;
+                abscissa_m = PartAbsToPathAbs(parts_[i]->CurveAbsToPathAbs(abscissaCurve_m, curveId), i);
+            }
+        }
+    } catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[CompositePath::FindClosestPoint] -> ") + exception.what());
+    }
+
+    abscissa_m = std::min(std::max(abscissa_m, 0.0), Length());
+
+    return closestPoint;
+}
+
+
+double CompositePath::FindAbscissaClosestPoint(Eigen::Vector3d& worldF_position) const
+{
+    double abscissa_m{0};
+
+    FindClosestPoint(worldF_position, abscissa_m);
+
+    return abscissa_m;
+}
+
+
+std::shared_ptr<std::vector<Eigen::Vector3d>> CompositePath::Sampling(int samples) const
+{
+    auto points = std::make_shared<std::vector<Eigen::Vector3d>>();
+
+    if(parts_.empty())
+        return points;
+
+    const int singlePartSamples{samples / PartsNumber()};
+
+    for(auto const& part: parts_) {
+        auto partPoints = part->Sampling(singlePartSamples);
+        points->insert(points->end(), partPoints->begin(), partPoints->end());
+    }
+
+    return points;
+}
+
+
+std::shared_ptr<Path> CompositePath::Flatten() const
+{
+    auto path = std::make_shared<Path>();
+
+    for(auto const& part: parts_)
+        path->Append(*part);
+
+    return path;
+}
@@ -0,0 +1,241 @@
+#include "sisl_toolbox/coverage_planner.hpp"
+
+#include "sisl_toolbox/path.hpp"
+#include "sisl_toolbox/path_factory.hpp"
+#include "sisl_toolbox/straight_line.hpp"
+#include "sisl_toolbox/circular_arc.hpp"
+#include "sisl_toolbox/geometry.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <set>
+#include <stdexcept>
+#include <string>
+
+
+CoveragePlanner::CoveragePlanner(double angle, int direction, double offset, std::vector<Eigen::Vector3d> const& polygonVerteces)
+: offset_{offset}
+, anchor_{0}
+, step_{0}
+, path_{std::make_shared<Path>()}
+, updatedLines_{0}
+, rebuiltCurves_{0}
+{
+    if(polygonVerteces.size() < 3)
+        throw std::runtime_error("[CoveragePlanner::CoveragePlanner] Input parameter error. The polygon needs at least 3 vertices");
+    if(offset <= 0)
+        throw std::runtime_error("[CoveragePlanner::CoveragePlanner] Input parameter error. offset must be positive");
+    if(direction != RIGHT and direction != LEFT)
+        throw std::runtime_error("[CoveragePlanner::CoveragePlanner] Input parameter error. direction must be RIGHT or LEFT");
+
+    const double angleRadians{Geometry::DegToRad(Geometry::ConvertToAngleInterval(angle))};
+    lineDirection_ = Eigen::Vector3d{std::cos(angleRadians), std::sin(angleRadians), 0};
+    lineNormal_ = Eigen::Vector3d{-lineDirection_[1], lineDirection_[0], 0};
+
+    double minV{std::numeric_limits<double>::max()};
+    double maxV{std::numeric_limits<double>::lowest()};
+    for(auto const& vertex: polygonVerteces) {
+        verteces_.emplace_back(vertex[0], vertex[1], 0);
+        sweepVerteces_.emplace_back(verteces_.back().dot(lineDirection_), verteces_.back().dot(lineNormal_));
+        minV = std::min(minV, sweepVerteces_.back()[1]);
+        maxV = std::max(maxV, sweepVerteces_.back()[1]);
+    }
+
+    // The first line is half an offset inside the polygon, on the side opposite to the first turn
+    step_ = (direction == RIGHT) ? -offset : offset;
+    anchor_ = (direction == RIGHT) ? maxV - offset / 2 : minV + offset / 2;
+
+    std::set<int> lines;
+    for(int edge = 0; edge < static_cast<int>(verteces_.size()); ++edge)
+        UpdateEdge(edge, false, lines);
+
+    legs_ = BuildLegs();
+    if(legs_.empty())
+        throw std::runtime_error("[CoveragePlanner::CoveragePlanner] Input parameter error. No sweep line crosses the polygon");
+
+    std::vector<std::shared_ptr<Curve>> curves;
+    for(int i = 0; i < 2 * LegsNumber() - 1; ++i)
+        curves.push_back(BuildCurve(legs_, i));
+
+    path_->name_ = "Coverage";
+
+    try {
+        path_->Replace(0, 0, curves);
+    } catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[CoveragePlanner::CoveragePlanner] -> ") + exception.what());
+    }
+
+    updatedLines_ = static_cast<int>(lines.size());
+    rebuiltCurves_ = static_cast<int>(curves.size());
+}
+
+
+void CoveragePlanner::UpdateEdge(int edge, bool remove, std::set<int>& lines)
+{
+    Eigen::Vector2d const& p{sweepVerteces_[edge]};
+    Eigen::Vector2d const& q{sweepVerteces_[(edge + 1) % sweepVerteces_.size()]};
+
+    // An edge crosses the lines in [minV, maxV): a vertex is counted once, a line parallel to an edge never.
+    const double minV{std::min(p[1], q[1])};
+    const double maxV{std::max(p[1], q[1])};
+    if(minV == maxV)
+        return;
+
+    const double first{(minV - anchor_) / step_};
+    const double last{(maxV - anchor_) / step_};
+    const int firstLine{static_cast<int>(std::floor(std::min(first, last))) - 1};
+    const int lastLine{static_cast<int>(std::ceil(std::max(first, last))) + 1};
+
+    for(int line = firstLine; line <= lastLine; ++line) {
+        const double v{LineOffset(line)};
+        if(v < minV or v >= maxV)
+            continue;
+
+        lines.insert(line);
+
+        if(remove) {
+            auto it = lines_.find(line);
+            if(it == lines_.end())
+                continue;
+            auto& crossings = it->second;
+            crossings.erase(std::remove_if(crossings.begin(), crossings.end(),
+                [edge](Crossing const& crossing) {return crossing.edge == edge;}), crossings.end());
+            if(crossings.empty())
+                lines_.erase(it);
+        } else {
+            lines_[line].push_back(Crossing{edge, p[0] + (v - p[1]) / (q[1] - p[1]) * (q[0] - p[0])});
+        }
+    }
+}
+
+
+void CoveragePlanner::UpdateVertex(int vertexId, Eigen::Vector3d const& position)
+{
+    const int verteces{static_cast<int>(verteces_.size())};
+    const int previousEdge{(vertexId + verteces - 1) % verteces};
+
+    std::set<int> lines;
+    UpdateEdge(previousEdge, true, lines);
+    UpdateEdge(vertexId, true, lines);
+
+    verteces_[vertexId] = Eigen::Vector3d{position[0], position[1], 0};
+    sweepVerteces_[vertexId] = Eigen::Vector2d{verteces_[vertexId].dot(lineDirection_), verteces_[vertexId].dot(lineNormal_)};
+
+    UpdateEdge(previousEdge, false, lines);
+    UpdateEdge(vertexId, false, lines);
+
+    updatedLines_ = static_cast<int>(lines.size());
+}
+
+
+void CoveragePlanner::MoveVertex(int vertexId, Eigen::Vector3d const& position)
+{
+    if(vertexId < 0 or vertexId >= static_cast<int>(verteces_.size()))
+        throw std::runtime_error("[CoveragePlanner::MoveVertex] Input parameter error. vertexId out of bound");
+
+    const Eigen::Vector3d previousPosition{verteces_[vertexId]};
+
+    UpdateVertex(vertexId, position);
+    auto legs = BuildLegs();
+
+    if(legs.empty()) {
+        UpdateVertex(vertexId, previousPosition);
+        throw std::runtime_error("[CoveragePlanner::MoveVertex] Input parameter error. No sweep line crosses the polygon");
+    }
+
+    // Common legs at the start and at the end: only the legs in between and their turns are rebuilt
+    auto sameLeg = [](Leg const& a, Leg const& b) {
+        return a.line == b.line and a.startU == b.startU and a.endU == b.endU;
+    };
+
+    const int oldLegs{LegsNumber()};
+    const int newLegs{static_cast<int>(legs.size())};
+    int prefix{0};
+    while(prefix < std::min(oldLegs, newLegs) and sameLeg(legs_[prefix], legs[prefix]))
+        ++prefix;
+    int suffix{0};
+    while(suffix < std::min(oldLegs, newLegs) - prefix and sameLeg(legs_[oldLegs - 1 - suffix], legs[newLegs - 1 - suffix]))
+        ++suffix;
+
+    rebuiltCurves_ = 0;
+    if(prefix == oldLegs and prefix == newLegs)
+        return;
+
+    // Curve 2i is the leg i, curve 2i + 1 the turn to the leg i + 1
+    const int firstCurve{std::max(2 * prefix - 1, 0)};
+    const int oldEndCurve{std::min(2 * (oldLegs - suffix), 2 * oldLegs - 1)};
+    const int newEndCurve{std::min(2 * (newLegs - suffix), 2 * newLegs - 1)};
+
+    std::vector<std::shared_ptr<Curve>> curves;
+    try {
+        for(int i = firstCurve; i < newEndCurve; ++i)
+            curves.push_back(BuildCurve(legs, i));
+
+        path_->Replace(firstCurve, oldEndCurve - firstCurve, curves);
+    } catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[CoveragePlanner::MoveVertex] -> ") + exception.what());
+    }
+
+    legs_ = std::move(legs);
+    rebuiltCurves_ = static_cast<int>(curves.size());
+}
+
+
+std::vector<CoveragePlanner::Leg> CoveragePlanner::BuildLegs() const
+{
+    // Span of the crossings of each line (the lines touching the polygon in a single vertex have no span)
+    std::vector<int> spanLines;
+    std::vector<double> spanStart;
+    std::vector<double> spanEnd;
+    for(auto const& line: lines_) {
+        if(line.second.size() < 2)
+            continue;
+        auto extrema = std::minmax_element(line.second.begin(), line.second.end(),
+            [](Crossing const& a, Crossing const& b) {return a.u < b.u;});
+        spanLines.push_back(line.first);
+        spanStart.push_back(extrema.first->u);
+        spanEnd.push_back(extrema.second->u);
+    }
+
+    // The even lines go along the sweep direction, the odd ones backwards. Each leg starts where the previous one ends
+    // and ends beyond the next one if it is longer on that side, so that the turns are semicircles.
+    std::vector<Leg> legs;
+    const int spans{static_cast<int>(spanLines.size())};
+    for(int i = 0; i < spans; ++i) {
+        const bool forward{(spanLines[i] & 1) == 0};
+        Leg leg{spanLines[i], forward ? spanStart[i] : spanEnd[i], forward ? spanEnd[i] : spanStart[i]};
+
+        if(i > 0)
+            leg.startU = legs.back().endU;
+        if(i + 1 < spans)
+            leg.endU = forward ? std::max(leg.endU, spanEnd[i + 1]) : std::min(leg.endU, spanStart[i + 1]);
+
+        legs.push_back(leg);
+    }
+
+    return legs;
+}
+
+
+std::shared_ptr<Curve> CoveragePlanner::BuildCurve(std::vector<Leg> const& legs, int curveId) const
+{
+    Leg const& leg{legs[curveId / 2]};
+    const double v{LineOffset(leg.line)};
+
+    if(curveId % 2 == 0)
+        return std::make_shared<StraightLine>(Point(leg.startU, v), Point(leg.endU, v));
+
+    // Counterclockwise turn if the next line is on the left of the leg
+    const double nextV{LineOffset(legs[curveId / 2 + 1].line)};
+    const bool forward{(leg.line & 1) == 0};
+    const double angle{((forward ? 1 : -1) * (nextV - v) > 0) ? M_PI : -M_PI};
+
+    return std::make_shared<CircularArc>(angle, Eigen::Vector3d{0, 0, 1}, Point(leg.endU, v), Point(leg.endU, (v + nextV) / 2));
+}
+
+
+Eigen::Vector3d CoveragePlanner::Point(double u, double v) const
+{
+    return u * lineDirection_ + v * lineNormal_;
+}
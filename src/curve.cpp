@@ -1,6 +1,16 @@
 ﻿#include "sisl_toolbox/curve.hpp"
+#include "sisl_toolbox/curve_approximation.hpp"
+#include "sisl_toolbox/curve_intersection.hpp"
+#include "sisl_toolbox/geometry.hpp"
 #include "sisl.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+
+constexpr double Curve::mergeDistance_;
+
 
 Curve::Curve(int dimension, int order) 
     : dimension_{dimension}
@@ -9,13 +19,22 @@ Curve::Curve(int dimension, int order)
     , startParameter_m_{0}
     , length_{0}
     , epsge_{0.000001} 
-    , curve_ {nullptr} {}
+    , curve_ {nullptr}
+    , kernel_ {&CurveKernelInterface::Select(nullptr)}
+    , approximationTolerance_ {0}
+    , boxMin_ {Eigen::Vector3d::Zero()}
+    , boxMax_ {Eigen::Vector3d::Zero()}
+    , startTangent_ {Eigen::Vector3d::Zero()}
+    , endTangent_ {Eigen::Vector3d::Zero()}
+    , startPointCurvature_ {0}
+    , endPointCurvature_ {0} {}
 
 
 Curve::Curve(SISLCurve *curve, int dimension, int order) 
     : Curve(dimension, order) {
 
         curve_ = curve;
+        BindKernel();
 
         // Pick parameters range of the curve.
         s1363(curve_, &startParameter_s_, &endParameter_s_, &statusFlag_);
@@ -33,6 +52,8 @@ Curve::Curve(SISLCurve *curve, int dimension, int order)
 
         startParameter_m_ = startParameter_s_ * (length_ / (endParameter_s_ - startParameter_s_));
         endParameter_m_ = endParameter_s_ * (length_ / (endParameter_s_ - startParameter_s_));
+
+        CacheEndpointData();
     }
 
 
@@ -89,9 +110,7 @@ void Curve::FromAbsSislToPos(double abscissa_s, Eigen::Vector3d& worldF_position
             throw std::runtime_error("[Curve::FromAbsSislToPos] Input parameter error. abscissa_s before endParameter_s_");
     }
 
-    int left{0}; // The SISL routine needs this variable, but it does not use the value.
-    
-    s1221(curve_, 0, abscissa_s, &left, &worldF_position[0], &statusFlag_);
+    kernel_->Position(curve_, abscissa_s, worldF_position);
 }
 
 
@@ -105,24 +124,29 @@ void Curve::FromAbsMetersToPos(double abscissa_m, Eigen::Vector3d& worldF_positi
         throw std::runtime_error(std::string("[Curve::FromAbsMetersToPos] -> ") + exception.what());
     } 
     
-    int left{0}; // The SISL routine needs this variable, but it does not use the value.
+    if(UseApproximation()) {
+        worldF_position = approximation_->At(abscissa_m);
+        return;
+    }
 
-    s1221(curve_, 0, abscissa_s, &left, &worldF_position[0], &statusFlag_);
+    kernel_->Position(curve_, abscissa_s, worldF_position);
 }
 
 
 Eigen::Vector3d Curve::At(double abscissa_m) {
 
     Eigen::Vector3d worldF_position{};
-    int leftknot{0}; // The SISL routine needs this variable, but it does not use the value.
     double abscissa_s{};
     try {
         abscissa_s = MeterAbsToSislAbs(abscissa_m);
     } catch(std::runtime_error const& exception) {
         throw std::runtime_error(std::string("[Curve::At] -> ") + exception.what());
     }    
+
+    if(UseApproximation())
+        return approximation_->At(abscissa_m);
     
-    s1227(curve_, 0, abscissa_s, &leftknot, &worldF_position[0], &statusFlag_);
+    kernel_->Position(curve_, abscissa_s, worldF_position);
 
     return worldF_position;
 }
@@ -131,9 +155,6 @@ Eigen::Vector3d Curve::At(double abscissa_m) {
 std::vector<Eigen::Vector3d> Curve::Derivate(int order, double abscissa_m) {
 
     std::vector<Eigen::Vector3d> derivates{};
-    std::vector<double> derivatesTmp(order * dimension_, 0);
-
-    int leftknot{0}; // The SISL routine needs this variable, but it does not use the value.
     double abscissa_s{};
     try {
         abscissa_s = MeterAbsToSislAbs(abscissa_m);
@@ -141,11 +162,18 @@ std::vector<Eigen::Vector3d> Curve::Derivate(int order, double abscissa_m) {
         throw std::runtime_error(std::string("[Curve::Derivate] -> ") + exception.what());
     }    
 
-    s1227(curve_, order, abscissa_s, &leftknot, &derivatesTmp[0], &statusFlag_);
-
-    for(int i = 1; i <= order; ++i) {
-        derivates.emplace_back(Eigen::Vector3d{derivatesTmp[i*3], derivatesTmp[i*3 + 1], derivatesTmp[i*3 + 2]});
+    // Position followed by the derivatives: drop the position.
+    if(order <= 2 and UseApproximation()) {
+        // Back to the derivatives w.r.t. the SISL parametrization.
+        const double scale{length_ / (endParameter_s_ - startParameter_s_)};
+        approximation_->Derivatives(order, abscissa_m, derivates);
+        for(int k = 1; k <= order; ++k)
+            derivates[k] *= std::pow(scale, k);
+    }
+    else {
+        kernel_->Derivatives(curve_, order, abscissa_s, derivates);
     }
+    derivates.erase(derivates.begin());
 
     return derivates;
 }
@@ -160,23 +188,102 @@ double Curve::Curvature(double abscissa_m) {
         throw std::runtime_error(std::string("[Curve::Curvature] -> ") + exception.what());
     }
 
-    std::array<double, 1> abscissaVector_s{abscissa_s};
-    int parameterNumber{1};
-    std::array<double, 1> curvature{};
+    if(UseApproximation())
+        return approximation_->Curvature(abscissa_m);
+
+    std::vector<Eigen::Vector3d> derivates;
+    kernel_->Derivatives(curve_, 2, abscissa_s, derivates);
 
-    s2550(curve_, &abscissaVector_s[0], parameterNumber, &curvature[0], &statusFlag_);
+    double speed{derivates[1].norm()};
+    if(speed == 0)
+        return 0;
 
-    return curvature[0];
+    return derivates[1].cross(derivates[2]).norm() / (speed * speed * speed);
 }
 
 
 void Curve::Reverse() 
 {
     s1706(curve_);
+    approximation_.reset();
 
     FromAbsSislToPos(startParameter_s_, startPoint_);
     FromAbsSislToPos(endParameter_s_, endPoint_);
 
+    CacheEndpointData();
+}
+
+
+void Curve::CopySislCurve()
+{
+    if(curve_ != nullptr)
+        curve_ = copyCurve(curve_);
+
+    BindKernel();
+}
+
+
+void Curve::EnableApproximation(double tolerance)
+{
+    if(tolerance <= 0)
+        throw std::runtime_error("[Curve::EnableApproximation] Input parameter error. tolerance must be positive");
+
+    if(tolerance != approximationTolerance_)
+        approximation_.reset();
+
+    approximationTolerance_ = tolerance;
+}
+
+
+void Curve::DisableApproximation()
+{
+    approximationTolerance_ = 0;
+    approximation_.reset();
+}
+
+
+std::shared_ptr<CurveApproximation const> Curve::Approximation()
+{
+    return UseApproximation() ? approximation_ : nullptr;
+}
+
+
+bool Curve::UseApproximation()
+{
+    if(approximationTolerance_ <= 0 or curve_ == nullptr or length_ <= 0)
+        return false;
+
+    if(approximation_)
+        return true;
+
+    const double scale{length_ / (endParameter_s_ - startParameter_s_)}; // Meters per SISL unit
+
+    // The knots are breakpoints: the derivatives of the curve may jump there.
+    std::vector<double> breakpoints_m{startParameter_m_};
+    for(int i = 0; i < curve_->in + curve_->ik; ++i) {
+        double knot_m{curve_->et[i] * scale};
+        if(knot_m > breakpoints_m.back() and knot_m < endParameter_m_)
+            breakpoints_m.push_back(knot_m);
+    }
+    breakpoints_m.push_back(endParameter_m_);
+
+    auto evaluator = [this, scale](double abscissa_m, bool fromLeft, std::vector<Eigen::Vector3d>& derivatives) {
+        // Step off the knot on the requested side: the conversion to the SISL parametrization may round either way.
+        const double towards{fromLeft ? startParameter_s_ : endParameter_s_};
+        double abscissa_s{std::min(std::max(abscissa_m / scale, startParameter_s_), endParameter_s_)};
+        abscissa_s = std::nextafter(std::nextafter(abscissa_s, towards), towards);
+        kernel_->Derivatives(curve_, 2, abscissa_s, derivatives);
+        derivatives[1] /= scale;
+        derivatives[2] /= scale * scale;
+    };
+
+    try {
+        approximation_ = std::make_shared<CurveApproximation>(evaluator, breakpoints_m, approximationTolerance_);
+    } catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[Curve::UseApproximation] -> ") + exception.what());
+    }
+
+    return true;
 }
 
 
@@ -184,16 +291,14 @@ std::shared_ptr<std::vector<Eigen::Vector3d>> Curve::Sampling(int const samples)
 {
     auto curve = std::make_shared<std::vector<Eigen::Vector3d>>();
 
-    int left{0};
-    int status{0};
     double param{0};
-    std::array<double, 3> pos{0};
+    Eigen::Vector3d pos{};
 
     for (double k = 0; k < samples; ++k) {
         param = startParameter_s_ + k / (samples - 1) * (endParameter_s_ - startParameter_s_);
-        s1221(curve_, 0, param, &left, &pos[0], &status);
+        kernel_->Position(curve_, param, pos);
         
-        curve->emplace_back(Eigen::Vector3d{pos[0], pos[1], pos[2]});
+        curve->emplace_back(pos);
     }
     
     return curve;
@@ -219,6 +324,62 @@ std::tuple<double, double> Curve::FindClosestPoint(Eigen::Vector3d& worldF_posit
 }
 
 
+std::tuple<double, double> Curve::FindClosestPointOnInterval(Eigen::Vector3d& worldF_position, double startValue_m, 
+    double endValue_m) 
+{
+    double abscissa_m{0};
+    double distance{0};
+
+    if(startValue_m > endValue_m)
+        std::swap(startValue_m, endValue_m);
+
+    try {
+        std::tie(abscissa_m, distance) = FindClosestPoint(worldF_position);
+    } catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[Curve::FindClosestPointOnInterval] -> ") + exception.what());
+    }
+
+    if(abscissa_m >= startValue_m and abscissa_m <= endValue_m)
+        return std::make_tuple(abscissa_m, distance);
+
+    // Coarse search on the portion (ends included), then a Newton iteration bounded to the portion.
+    constexpr int samples{16};
+    double bestAbscissa_m{startValue_m};
+    double bestDistance{std::numeric_limits<double>::max()};
+
+    try {
+        for(int i = 0; i <= samples; ++i) {
+            const double value_m{startValue_m + (endValue_m - startValue_m) * i / samples};
+            distance = (At(value_m) - worldF_position).norm();
+            if(distance < bestDistance) {
+                bestDistance = distance;
+                bestAbscissa_m = value_m;
+            }
+        }
+
+        const double startValue_s{MeterAbsToSislAbs(startValue_m)};
+        const double endValue_s{MeterAbsToSislAbs(endValue_m)};
+        double abscissa_s{0};
+
+        s1774(curve_, &worldF_position[0], dimension_, epsge_, std::min(startValue_s, endValue_s), 
+            std::max(startValue_s, endValue_s), MeterAbsToSislAbs(bestAbscissa_m), &abscissa_s, &statusFlag_);
+
+        if(statusFlag_ >= 0) {
+            abscissa_m = std::min(std::max(SislAbsToMeterAbs(abscissa_s), startValue_m), endValue_m);
+            distance = (At(abscissa_m) - worldF_position).norm();
+            if(distance < bestDistance) {
+                bestDistance = distance;
+                bestAbscissa_m = abscissa_m;
+            }
+        }
+    } catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[Curve::FindClosestPointOnInterval] -> ") + exception.what());
+    }
+
+    return std::make_tuple(bestAbscissa_m, bestDistance);
+}
+
+
 std::shared_ptr<Curve> Curve::ExtractSection(double startValue_m, double endValue_m) {
 
     double startValue{0};
@@ -234,13 +395,54 @@ std::shared_ptr<Curve> Curve::ExtractSection(double startValue_m, double endValu
     SISLCurve* curveSection;
     s1712(curve_, startValue, endValue, &curveSection, &statusFlag_);
 
-    auto curveSectionSmart = std::make_shared<Curve>(curveSection);
+    auto curveSectionSmart = std::make_shared<Curve>(curveSection, curveSection->idim, curveSection->ik);
     curveSectionSmart->name_ = name_; 
 
     return curveSectionSmart;
 }
 
 
+std::shared_ptr<Curve> Curve::Offset(double distance, double tolerance) {
+
+    SISLCurve* offsetCurve{nullptr};
+    double maxStep{0}; // Neglected, the maximal step length is computed by SISL
+    // The offset direction is the cross product among the tangent and this vector, as for the normal in EvalTangentFrame.
+    Eigen::Vector3d normalDirection{-Eigen::Vector3d::UnitZ()};
+
+    s1360(curve_, distance, tolerance, &normalDirection[0], maxStep, dimension_, &offsetCurve, &statusFlag_);
+
+    if(statusFlag_ < 0 or offsetCurve == nullptr)
+        throw std::runtime_error("[Curve::Offset] s1360 failed with status " + std::to_string(statusFlag_));
+
+    auto offsetCurveSmart = std::make_shared<Curve>(offsetCurve, offsetCurve->idim, offsetCurve->ik);
+    offsetCurveSmart->name_ = name_;
+
+    return offsetCurveSmart;
+}
+
+
+std::shared_ptr<Curve> Curve::Join(std::shared_ptr<Curve> otherCurve, double tolerance) {
+
+    if(curve_ == nullptr or otherCurve->CurvePtr() == nullptr)
+        return nullptr;
+
+    if((endPoint_ - otherCurve->StartPoint()).norm() > tolerance)
+        return nullptr;
+
+    SISLCurve* joinedCurve{nullptr};
+    int firstEnd{1};  // End of this curve
+    int secondEnd{0}; // Start of the other curve
+
+    s1715(curve_, otherCurve->CurvePtr(), firstEnd, secondEnd, &joinedCurve, &statusFlag_);
+
+    if(statusFlag_ < 0 or joinedCurve == nullptr)
+        return nullptr;
+
+    // The joined curve has the order of the SISL result (s1715 raises it to the higher of the two).
+    return std::make_shared<Curve>(joinedCurve, joinedCurve->idim, joinedCurve->ik);
+}
+
+
 std::vector<Eigen::Vector3d> Curve::Intersection(std::shared_ptr<Curve> otherCurve) {
     
     double epsco{0};
@@ -253,42 +455,122 @@ std::vector<Eigen::Vector3d> Curve::Intersection(std::shared_ptr<Curve> otherCur
     std::vector<Eigen::Vector3d> intersections{};
     Eigen::Vector3d intersectionPoint;
 
-    if(otherCurve->Length() == 0)
+    if(Length() == 0 or otherCurve->Length() == 0)
         return intersections;
 
-    s1857(curve_, otherCurve->CurvePtr(), epsco, epsge_, &intersectionsNum, &intersectionsFirstCurve, &intersectionsSecondCurve, 
-        &numintcu, &intcurve, &statusFlag_);
+    // Broad phase: no SISL call when the bounding boxes are apart.
+    if(not BoxesOverlap(*otherCurve, epsge_))
+        return intersections;
+
+    // Analytic curves (e.g. Clothoid) have no SISL representation: let them solve the problem.
+    if(otherCurve->CurvePtr() == nullptr)
+        return otherCurve->Intersection(shared_from_this());
+
+    // Straight lines and circular arcs on the same plane parallel to xy: closed form solution, s1857 otherwise.
+    std::vector<CurveIntersection::Point> analyticIntersections;
+    const bool analytic{CurveIntersection::Evaluate(*this, *otherCurve, epsge_, analyticIntersections)};
+
+    if(not analytic) {
+        s1857(curve_, otherCurve->CurvePtr(), epsco, epsge_, &intersectionsNum, &intersectionsFirstCurve, &intersectionsSecondCurve, 
+            &numintcu, &intcurve, &statusFlag_);
+    }
+    else {
+        intersectionsNum = static_cast<int>(analyticIntersections.size());
+    }
 
     for(auto i = 0; i < intersectionsNum; ++i) {
 
-        try {
-            FromAbsSislToPos(intersectionsFirstCurve[i], intersectionPoint);
-        } catch(std::runtime_error const& exception) {
-            throw std::runtime_error(std::string("[Curve::Intersection] -> ") + exception.what());
+        if(analytic) {
+            intersectionPoint = analyticIntersections[i].position;
         }
-        
-        intersectionPoint[0] = std::round(intersectionPoint[0] * 1000) / 1000;
-        intersectionPoint[1] = std::round(intersectionPoint[1] * 1000) / 1000;
-        intersectionPoint[2] = std::round(intersectionPoint[2] * 1000) / 1000;
-
-        if (std::count(intersections.begin(), intersections.end(), intersectionPoint) == 0) {
-            intersections.push_back(intersectionPoint);
+        else {
+            try {
+                FromAbsSislToPos(intersectionsFirstCurve[i], intersectionPoint);
+            } catch(std::runtime_error const& exception) {
+                throw std::runtime_error(std::string("[Curve::Intersection] -> ") + exception.what());
+            }
         }
+
+        // The same intersection may be reported twice (e.g. by s1857 at a knot): merge the points within the resolution.
+        Geometry::AddUniquePoint(intersections, intersectionPoint, mergeDistance_);
     }
 
     return intersections;
 }
 
 
+bool Curve::BoxesOverlap(Curve const& otherCurve, double tolerance) const
+{
+    return (boxMin_.array() - tolerance <= otherCurve.boxMax_.array()).all() 
+       and (otherCurve.boxMin_.array() - tolerance <= boxMax_.array()).all();
+}
+
+
+void Curve::EvalBoundingBox(Eigen::Vector3d& boxMin, Eigen::Vector3d& boxMax)
+{
+    boxMin = startPoint_.cwiseMin(endPoint_);
+    boxMax = startPoint_.cwiseMax(endPoint_);
+
+    if(curve_ == nullptr)
+        return;
+
+    // The curve lies in the convex hull of its control polygon (ecoef holds the projected vertices of rational curves).
+    const int dimension{std::min(curve_->idim, 3)};
+    for(int i = 0; i < curve_->in; ++i) {
+        for(int k = 0; k < dimension; ++k) {
+            const double coefficient{curve_->ecoef[i * curve_->idim + k]};
+            boxMin[k] = std::min(boxMin[k], coefficient);
+            boxMax[k] = std::max(boxMax[k], coefficient);
+        }
+    }
+}
+
+
+void Curve::CacheEndpointData()
+{
+    EvalBoundingBox(boxMin_, boxMax_);
+
+    if(length_ == 0) {
+        startTangent_ = endTangent_ = Eigen::Vector3d::Zero();
+        startPointCurvature_ = endPointCurvature_ = 0;
+        return;
+    }
+
+    // The SISL curves are evaluated with the kernel, not through Derivate and Curvature: the approximation (dropped by the 
+    // callers changing the curve) stays lazily built at the first query.
+    if(curve_ != nullptr) {
+        std::vector<Eigen::Vector3d> derivates;
+        auto endpoint = [&](double abscissa_s, Eigen::Vector3d& tangent, double& curvature) {
+            kernel_->Derivatives(curve_, 2, abscissa_s, derivates);
+            const double speed{derivates[1].norm()};
+            tangent = derivates[1].normalized();
+            curvature = speed > 0 ? derivates[1].cross(derivates[2]).norm() / (speed * speed * speed) : 0;
+        };
+        endpoint(startParameter_s_, startTangent_, startPointCurvature_);
+        endpoint(endParameter_s_, endTangent_, endPointCurvature_);
+        return;
+    }
+
+    try {
+        startTangent_ = Derivate(1, startParameter_m_)[0].normalized();
+        endTangent_ = Derivate(1, endParameter_m_)[0].normalized();
+        startPointCurvature_ = Curvature(startParameter_m_);
+        endPointCurvature_ = Curvature(endParameter_m_);
+    } catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[Curve::CacheEndpointData] -> ") + exception.what());
+    }
+}
+
+
 void Curve::EvalTangentFrame(double abscissa_m, Eigen::Vector3d& tangent, Eigen::Vector3d& normal, Eigen::Vector3d& binormal)
 {
     
-    std::array<double, 3> worldF_position{ 0 };
-
     double abscissa_s{};
     abscissa_s = MeterAbsToSislAbs(abscissa_m);
 
-    s2559(curve_, &abscissa_s, 1, &worldF_position[0], &tangent[0], &normal[0], &binormal[0], &statusFlag_);
+    std::vector<Eigen::Vector3d> derivates;
+    kernel_->Derivatives(curve_, 1, abscissa_s, derivates);
+    tangent = derivates[1].normalized();
 
     normal = tangent.cross(-Eigen::Vector3d::UnitZ());
     binormal = tangent.cross(normal);
@@ -299,16 +581,14 @@ void Curve::EvalFSFrame(double abscissa_s, Eigen::Vector3d& tangent, Eigen::Vect
 {
 
     std::array<double, 3> worldF_position{ 0 };
-    Eigen::VectorXd derive = Eigen::VectorXd::Zero(12);
-    int leftknot = 0;
-    int kstat = 0;
+    std::vector<Eigen::Vector3d> derive;
 
-    s1221(curve_, 3, abscissa_s, &leftknot, &derive[0], &kstat );
+    kernel_->Derivatives(curve_, 3, abscissa_s, derive);
     s2559(curve_, &abscissa_s, 1, &worldF_position[0], &tangent[0], &normal[0], &binormal[0], &statusFlag_);
 
-    Eigen::Vector3d r_prime = derive.segment(3,5);
-    Eigen::Vector3d r_2prime = derive.segment(6,8);
-    Eigen::Vector3d r_3prime = derive.segment(9,12);
+    Eigen::Vector3d r_prime = derive[1];
+    Eigen::Vector3d r_2prime = derive[2];
+    Eigen::Vector3d r_3prime = derive[3];
 
     double k = (r_prime.cross(r_2prime)).norm()/
                 std::pow((r_prime).norm(),3);
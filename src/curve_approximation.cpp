@@ -0,0 +1,227 @@
+#include "sisl_toolbox/curve_approximation.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+
+constexpr int CurveApproximation::maxDepth_;
+
+
+CurveApproximation::CurveApproximation(Evaluator const& evaluator, std::vector<double> const& breakpoints_m, double tolerance)
+: tolerance_{tolerance}
+{
+    if(breakpoints_m.size() < 2)
+        throw std::runtime_error("[CurveApproximation::CurveApproximation] Input parameter error. At least 2 breakpoints are needed");
+    if(tolerance <= 0)
+        throw std::runtime_error("[CurveApproximation::CurveApproximation] Input parameter error. tolerance must be positive");
+
+    std::vector<Eigen::Vector3d> start;
+    std::vector<Eigen::Vector3d> end;
+
+    for(std::size_t i = 0; i + 1 < breakpoints_m.size(); ++i) {
+        if(breakpoints_m[i + 1] <= breakpoints_m[i])
+            continue;
+        evaluator(breakpoints_m[i], false, start);
+        evaluator(breakpoints_m[i + 1], true, end);
+        Refine(evaluator, breakpoints_m[i], start, breakpoints_m[i + 1], end, 0);
+    }
+
+    if(coefficients_.empty())
+        throw std::runtime_error("[CurveApproximation::CurveApproximation] Input parameter error. The breakpoints span an empty interval");
+
+    breakpoints_m_.push_back(breakpoints_m.back());
+
+    arcLengths_.resize(breakpoints_m_.size());
+    arcLengths_[0] = 0;
+    for(int i = 0; i < PiecesNumber(); ++i)
+        arcLengths_[i + 1] = arcLengths_[i] + PieceArcLength(i, breakpoints_m_[i + 1] - breakpoints_m_[i]);
+}
+
+
+void CurveApproximation::EvaluatePiece(Coefficients const& c, double u, int order, std::vector<Eigen::Vector3d>& derivatives)
+{
+    derivatives.resize(order + 1);
+
+    derivatives[0] = ((((c.col(5) * u + c.col(4)) * u + c.col(3)) * u + c.col(2)) * u + c.col(1)) * u + c.col(0);
+    if(order >= 1)
+        derivatives[1] = (((5 * c.col(5) * u + 4 * c.col(4)) * u + 3 * c.col(3)) * u + 2 * c.col(2)) * u + c.col(1);
+    if(order >= 2)
+        derivatives[2] = ((20 * c.col(5) * u + 12 * c.col(4)) * u + 6 * c.col(3)) * u + 2 * c.col(2);
+}
+
+
+CurveApproximation::Coefficients CurveApproximation::Interpolate(std::vector<Eigen::Vector3d> const& start,
+    std::vector<Eigen::Vector3d> const& end, double width)
+{
+    // Hermite data w.r.t. the normalized parameter t = u / width.
+    const Eigen::Vector3d delta{end[0] - start[0]};
+    const Eigen::Vector3d v0{width * start[1]};
+    const Eigen::Vector3d v1{width * end[1]};
+    const Eigen::Vector3d a0{width * width * start[2]};
+    const Eigen::Vector3d a1{width * width * end[2]};
+
+    Coefficients c;
+    c.col(0) = start[0];
+    c.col(1) = v0;
+    c.col(2) = 0.5 * a0;
+    c.col(3) = 10 * delta - 6 * v0 - 4 * v1 - 1.5 * a0 + 0.5 * a1;
+    c.col(4) = -15 * delta + 8 * v0 + 7 * v1 + 1.5 * a0 - a1;
+    c.col(5) = 6 * delta - 3 * v0 - 3 * v1 - 0.5 * a0 + 0.5 * a1;
+
+    // Back to the offset u.
+    double scale{1};
+    for(int k = 1; k < 6; ++k) {
+        scale /= width;
+        c.col(k) *= scale;
+    }
+
+    return c;
+}
+
+
+void CurveApproximation::Refine(Evaluator const& evaluator, double startAbscissa_m, std::vector<Eigen::Vector3d> const& start,
+    double endAbscissa_m, std::vector<Eigen::Vector3d> const& end, int depth)
+{
+    const double width{endAbscissa_m - startAbscissa_m};
+    const Coefficients coefficients{Interpolate(start, end, width)};
+
+    // Check points: the middle (reused by the bisection) and the quarters.
+    std::vector<Eigen::Vector3d> middle;
+    std::vector<Eigen::Vector3d> exact;
+    std::vector<Eigen::Vector3d> approximated;
+    double error{0};
+
+    for(double t: {0.5, 0.25, 0.75}) {
+        evaluator(startAbscissa_m + t * width, false, t == 0.5 ? middle : exact);
+        EvaluatePiece(coefficients, t * width, 2, approximated);
+        auto const& reference = t == 0.5 ? middle : exact;
+        // The error on the k-th derivative is scaled by width^k, i.e. its effect on the position over the piece.
+        double scale{1};
+        for(int k = 0; k <= 2; ++k) {
+            error = std::max(error, (approximated[k] - reference[k]).norm() * scale);
+            scale *= width;
+        }
+    }
+
+    // At the maximum depth the piece is kept anyway: the error recorded in maxError_ flags the approximation as not converged.
+    if(error <= tolerance_ or depth >= maxDepth_) {
+        breakpoints_m_.push_back(startAbscissa_m);
+        coefficients_.push_back(coefficients);
+        maxError_ = std::max(maxError_, error);
+        return;
+    }
+
+    const double middleAbscissa_m{startAbscissa_m + 0.5 * width};
+    Refine(evaluator, startAbscissa_m, start, middleAbscissa_m, middle, depth + 1);
+    Refine(evaluator, middleAbscissa_m, middle, endAbscissa_m, end, depth + 1);
+}
+
+
+int CurveApproximation::FindPiece(double abscissa_m, double& offset_m) const
+{
+    const int pieces{PiecesNumber()};
+
+    abscissa_m = std::min(std::max(abscissa_m, breakpoints_m_.front()), breakpoints_m_.back());
+
+    const int piece{static_cast<int>(std::upper_bound(breakpoints_m_.begin() + 1, breakpoints_m_.begin() + pieces, abscissa_m)
+        - breakpoints_m_.begin()) - 1};
+
+    offset_m = abscissa_m - breakpoints_m_[piece];
+
+    return piece;
+}
+
+
+Eigen::Vector3d CurveApproximation::At(double abscissa_m) const
+{
+    double u{0};
+    auto const& c = coefficients_[FindPiece(abscissa_m, u)];
+
+    return ((((c.col(5) * u + c.col(4)) * u + c.col(3)) * u + c.col(2)) * u + c.col(1)) * u + c.col(0);
+}
+
+
+void CurveApproximation::Derivatives(int order, double abscissa_m, std::vector<Eigen::Vector3d>& derivatives) const
+{
+    if(order < 0 or order > 2)
+        throw std::runtime_error("[CurveApproximation::Derivatives] Input parameter error. order must be in [0, 2]");
+
+    double u{0};
+    const int piece{FindPiece(abscissa_m, u)};
+    EvaluatePiece(coefficients_[piece], u, order, derivatives);
+}
+
+
+double CurveApproximation::Curvature(double abscissa_m) const
+{
+    std::vector<Eigen::Vector3d> derivatives;
+    Derivatives(2, abscissa_m, derivatives);
+
+    double speed{derivatives[1].norm()};
+    if(speed == 0)
+        return 0;
+
+    return derivatives[1].cross(derivatives[2]).norm() / (speed * speed * speed);
+}
+
+
+double CurveApproximation::PieceArcLength(int piece, double offset_m) const
+{
+    // 5 points Gauss-Legendre rule on [0, 1].
+    static constexpr double gaussNodes[5]{0.04691007703066800, 0.23076534494715845, 0.5, 0.76923465505284155, 0.95308992296933200};
+    static constexpr double gaussWeights[5]{0.11846344252809454, 0.23931433524968323, 0.28444444444444444, 0.23931433524968323,
+                                            0.11846344252809454};
+
+    auto const& c = coefficients_[piece];
+    double arcLength{0};
+
+    for(int i = 0; i < 5; ++i) {
+        double u{gaussNodes[i] * offset_m};
+        arcLength += gaussWeights[i]
+            * ((((5 * c.col(5) * u + 4 * c.col(4)) * u + 3 * c.col(3)) * u + 2 * c.col(2)) * u + c.col(1)).norm();
+    }
+
+    return arcLength * offset_m;
+}
+
+
+double CurveApproximation::ArcLength(double abscissa_m) const
+{
+    double u{0};
+    int piece{FindPiece(abscissa_m, u)};
+
+    return arcLengths_[piece] + PieceArcLength(piece, u);
+}
+
+
+double CurveApproximation::MeterAbs(double arcLength_m) const
+{
+    const int pieces{PiecesNumber()};
+
+    arcLength_m = std::min(std::max(arcLength_m, 0.0), arcLengths_.back());
+
+    const int piece{static_cast<int>(std::upper_bound(arcLengths_.begin() + 1, arcLengths_.begin() + pieces, arcLength_m)
+        - arcLengths_.begin()) - 1};
+
+    const double width{breakpoints_m_[piece + 1] - breakpoints_m_[piece]};
+    const double pieceArcLength{arcLengths_[piece + 1] - arcLengths_[piece]};
+    const double target{arcLength_m - arcLengths_[piece]};
+
+    // Newton iteration on the arc length of the piece, starting from the linear guess.
+    double u{pieceArcLength > 0 ? width * target / pieceArcLength : 0};
+    std::vector<Eigen::Vector3d> derivatives;
+
+    for(int iteration = 0; iteration < 8; ++iteration) {
+        EvaluatePiece(coefficients_[piece], u, 1, derivatives);
+        double speed{derivatives[1].norm()};
+        if(speed == 0)
+            break;
+        double step{(PieceArcLength(piece, u) - target) / speed};
+        u = std::min(std::max(u - step, 0.0), width);
+        if(std::abs(step) < 1e-12 * std::max(1.0, width))
+            break;
+    }
+
+    return breakpoints_m_[piece] + u;
+}
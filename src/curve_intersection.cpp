@@ -0,0 +1,259 @@
+#include "sisl_toolbox/curve_intersection.hpp"
+#include "sisl_toolbox/straight_line.hpp"
+#include "sisl_toolbox/circular_arc.hpp"
+#include "sisl_toolbox/geometry.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+
+bool CurveIntersection::MakePrimitive(Curve const& curve, double tolerance, Primitive& primitive)
+{
+    const Eigen::Vector3d startPoint{curve.StartPoint()};
+    const Eigen::Vector3d endPoint{curve.EndPoint()};
+
+    if(std::abs(endPoint[2] - startPoint[2]) > tolerance)
+        return false;
+
+    primitive.startPoint = startPoint.head<2>();
+    primitive.length = curve.Length();
+
+    if(dynamic_cast<StraightLine const*>(&curve) != nullptr) {
+        primitive.isArc = false;
+        primitive.endPoint = endPoint.head<2>();
+        primitive.direction = primitive.endPoint - primitive.startPoint;
+        return true;
+    }
+
+    auto arc = dynamic_cast<CircularArc const*>(&curve);
+    if(arc == nullptr)
+        return false;
+
+    // Only arcs around an axis parallel to z, as in CircularArc::Offset.
+    const Eigen::Vector3d unitAxis{arc->Axis().normalized()};
+    if(std::abs(std::abs(unitAxis[2]) - 1) > 1e-9 or std::abs(arc->CentrePoint()[2] - startPoint[2]) > tolerance)
+        return false;
+
+    const Eigen::Vector2d radial{primitive.startPoint - arc->CentrePoint().head<2>()};
+
+    primitive.isArc = true;
+    primitive.centre = arc->CentrePoint().head<2>();
+    primitive.radius = radial.norm();
+    primitive.startAngle = std::atan2(radial[1], radial[0]);
+    primitive.sense = (arc->Angle() * unitAxis[2] > 0) ? 1.0 : -1.0;
+
+    return primitive.radius > tolerance;
+}
+
+
+double CurveIntersection::ArcLength(Primitive const& arc, Eigen::Vector2d const& point, double tolerance)
+{
+    const Eigen::Vector2d radial{point - arc.centre};
+
+    // Swept angle from the start, in the direction of travel, in [0, 2pi).
+    const double angle{Geometry::ConvertToRadInterval(arc.sense * (std::atan2(radial[1], radial[0]) - arc.startAngle))};
+    const double arcLength{angle * arc.radius};
+
+    if(arcLength <= arc.length + tolerance)
+        return std::min(arcLength, arc.length);
+    if(2 * M_PI * arc.radius - arcLength <= tolerance)
+        return 0;
+
+    return -1;
+}
+
+
+double CurveIntersection::LineLength(Primitive const& line, double parameter, double tolerance)
+{
+    const double lineLength{parameter * line.length};
+
+    if(lineLength < -tolerance or lineLength > line.length + tolerance)
+        return -1;
+
+    return std::min(std::max(lineLength, 0.0), line.length);
+}
+
+
+void CurveIntersection::LineLine(Primitive const& first, Primitive const& second, double tolerance,
+    std::vector<Eigen::Vector2d>& points, std::vector<double>& firstLengths, std::vector<double>& secondLengths)
+{
+    const Eigen::Vector2d offset{second.startPoint - first.startPoint};
+    const double cross{first.direction[0] * second.direction[1] - first.direction[1] * second.direction[0]};
+
+    const bool collinear{Geometry::Orient2d(first.startPoint, first.endPoint, second.startPoint) == 0 
+        and Geometry::Orient2d(first.startPoint, first.endPoint, second.endPoint) == 0};
+
+    if(collinear or std::abs(cross) <= 1e-12 * first.length * second.length) {
+
+        // Parallel lines: only collinear lines touching at their ends give a point, overlaps are not reported.
+        const Eigen::Vector2d unitDirection{first.direction / first.length};
+        if(std::abs(unitDirection[0] * offset[1] - unitDirection[1] * offset[0]) > tolerance)
+            return;
+
+        const double secondStart{unitDirection.dot(offset)};
+        const double secondEnd{secondStart + unitDirection.dot(second.direction)};
+        const double overlapStart{std::max(0.0, std::min(secondStart, secondEnd))};
+        const double overlapEnd{std::min(first.length, std::max(secondStart, secondEnd))};
+
+        if(overlapEnd < overlapStart - tolerance or overlapEnd > overlapStart + tolerance)
+            return;
+
+        const double firstLength{std::min(std::max(0.5 * (overlapStart + overlapEnd), 0.0), first.length)};
+        points.push_back(first.startPoint + unitDirection * firstLength);
+        firstLengths.push_back(firstLength);
+        secondLengths.push_back(std::min(std::abs(firstLength - secondStart), second.length));
+        return;
+    }
+
+    const double firstParameter{(offset[0] * second.direction[1] - offset[1] * second.direction[0]) / cross};
+    const double secondParameter{(offset[0] * first.direction[1] - offset[1] * first.direction[0]) / cross};
+
+    // Exact crossing: the parameters are only clamped, whatever the rounding of the division.
+    const bool crossing{Geometry::SegmentsIntersect(first.startPoint, first.endPoint, second.startPoint, second.endPoint)};
+    const double firstLength{LineLength(first, firstParameter, crossing ? std::numeric_limits<double>::infinity() : tolerance)};
+    const double secondLength{LineLength(second, secondParameter, crossing ? std::numeric_limits<double>::infinity() : tolerance)};
+
+    if(firstLength < 0 or secondLength < 0)
+        return;
+
+    points.push_back(first.startPoint + first.direction * (firstLength / first.length));
+    firstLengths.push_back(firstLength);
+    secondLengths.push_back(secondLength);
+}
+
+
+void CurveIntersection::LineArc(Primitive const& line, Primitive const& arc, double tolerance,
+    std::vector<Eigen::Vector2d>& points, std::vector<double>& lineLengths, std::vector<double>& arcLengths)
+{
+    const Eigen::Vector2d unitDirection{line.direction / line.length};
+    const Eigen::Vector2d relative{line.startPoint - arc.centre};
+
+    // Foot of the perpendicular from the centre, then half chord on both sides: |relative + t * unitDirection| = radius.
+    const double foot{-unitDirection.dot(relative)};
+    const double distance{std::abs(unitDirection[0] * relative[1] - unitDirection[1] * relative[0])};
+
+    if(distance > arc.radius + tolerance)
+        return;
+
+    // Tangent contact when the chord is within tolerance.
+    double halfChord{std::sqrt(std::max(0.0, arc.radius * arc.radius - distance * distance))};
+    if(halfChord <= tolerance)
+        halfChord = 0;
+
+    for(double t: {foot - halfChord, foot + halfChord}) {
+        const double lineLength{LineLength(line, t / line.length, tolerance)};
+        if(lineLength >= 0) {
+            const Eigen::Vector2d point{line.startPoint + unitDirection * lineLength};
+            const double arcLength{ArcLength(arc, point, tolerance)};
+            if(arcLength >= 0) {
+                points.push_back(point);
+                lineLengths.push_back(lineLength);
+                arcLengths.push_back(arcLength);
+            }
+        }
+        if(halfChord == 0)
+            break;
+    }
+}
+
+
+void CurveIntersection::ArcArc(Primitive const& first, Primitive const& second, double tolerance,
+    std::vector<Eigen::Vector2d>& points, std::vector<double>& firstLengths, std::vector<double>& secondLengths)
+{
+    const Eigen::Vector2d centres{second.centre - first.centre};
+    const double distance{centres.norm()};
+    const double r1{first.radius};
+    const double r2{second.radius};
+
+    if(distance <= tolerance) {
+
+        // Concentric arcs: co-circular arcs touching at their ends give a point, overlaps are not reported.
+        if(std::abs(r1 - r2) > tolerance)
+            return;
+
+        // Ends of the second arc lying on the first one: a single contact at an end of the first arc is a touching point.
+        const double endAngle{second.startAngle + second.sense * second.length / r2};
+        const Eigen::Vector2d secondEnds[2]{second.startPoint, second.centre + r2 * Eigen::Vector2d{std::cos(endAngle), std::sin(endAngle)}};
+        const double secondEndLengths[2]{0, second.length};
+
+        int contacts{0};
+        double firstLength{0};
+        double secondLength{0};
+        for(int i = 0; i < 2; ++i) {
+            const double length{ArcLength(first, secondEnds[i], tolerance)};
+            if(length >= 0) {
+                ++contacts;
+                firstLength = length;
+                secondLength = secondEndLengths[i];
+            }
+        }
+        if(contacts != 1 or (firstLength > tolerance and firstLength < first.length - tolerance))
+            return;
+
+        const double angle{first.startAngle + first.sense * firstLength / r1};
+        points.push_back(first.centre + r1 * Eigen::Vector2d{std::cos(angle), std::sin(angle)});
+        firstLengths.push_back(firstLength);
+        secondLengths.push_back(secondLength);
+        return;
+    }
+
+    if(distance > r1 + r2 + tolerance or distance < std::abs(r1 - r2) - tolerance)
+        return;
+
+    const double a{(r1 * r1 - r2 * r2 + distance * distance) / (2 * distance)};
+    double h{std::sqrt(std::max(0.0, r1 * r1 - a * a))};
+    if(h <= tolerance)
+        h = 0;
+
+    const Eigen::Vector2d axis{centres / distance};
+    const Eigen::Vector2d base{first.centre + a * axis};
+    const Eigen::Vector2d perpendicular{-axis[1], axis[0]};
+
+    for(double sign: {-1.0, 1.0}) {
+        const Eigen::Vector2d point{base + sign * h * perpendicular};
+        const double firstLength{ArcLength(first, point, tolerance)};
+        const double secondLength{ArcLength(second, point, tolerance)};
+        if(firstLength >= 0 and secondLength >= 0) {
+            points.push_back(point);
+            firstLengths.push_back(firstLength);
+            secondLengths.push_back(secondLength);
+        }
+        if(h == 0)
+            break;
+    }
+}
+
+
+bool CurveIntersection::Evaluate(Curve const& first, Curve const& second, double tolerance, std::vector<Point>& points)
+{
+    Primitive firstPrimitive;
+    Primitive secondPrimitive;
+
+    if(first.Length() <= 0 or second.Length() <= 0 or not MakePrimitive(first, tolerance, firstPrimitive)
+        or not MakePrimitive(second, tolerance, secondPrimitive))
+        return false;
+
+    const double elevation{first.StartPoint()[2]};
+    if(std::abs(second.StartPoint()[2] - elevation) > tolerance)
+        return false;
+
+    std::vector<Eigen::Vector2d> planarPoints;
+    std::vector<double> firstLengths;
+    std::vector<double> secondLengths;
+
+    if(not firstPrimitive.isArc and not secondPrimitive.isArc)
+        LineLine(firstPrimitive, secondPrimitive, tolerance, planarPoints, firstLengths, secondLengths);
+    else if(not firstPrimitive.isArc)
+        LineArc(firstPrimitive, secondPrimitive, tolerance, planarPoints, firstLengths, secondLengths);
+    else if(not secondPrimitive.isArc)
+        LineArc(secondPrimitive, firstPrimitive, tolerance, planarPoints, secondLengths, firstLengths);
+    else
+        ArcArc(firstPrimitive, secondPrimitive, tolerance, planarPoints, firstLengths, secondLengths);
+
+    points.clear();
+    for(std::size_t i = 0; i < planarPoints.size(); ++i)
+        points.push_back(Point{Eigen::Vector3d{planarPoints[i][0], planarPoints[i][1], elevation}, firstLengths[i], secondLengths[i]});
+
+    return true;
+}
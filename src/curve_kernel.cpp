@@ -0,0 +1,244 @@
+#include "sisl_toolbox/curve_kernel.hpp"
+#include "sisl.h"
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+
+
+template <int Dim, int Order>
+constexpr int CurveKernel<Dim, Order>::degree_;
+
+
+template <int Dim, int Order>
+int CurveKernel<Dim, Order>::FindSpan(SISLCurve const* curve, double abscissa_s)
+{
+    const double* knots{curve->et};
+    const int lastSpan{curve->in - 1};
+
+    if(abscissa_s >= knots[lastSpan + 1]) {
+        int span{lastSpan};
+        while(span > degree_ and knots[span] == knots[span + 1])
+            --span;
+        return span;
+    }
+
+    const int span{static_cast<int>(std::upper_bound(knots + degree_, knots + lastSpan + 1, abscissa_s) - knots) - 1};
+
+    return std::max(span, degree_);
+}
+
+
+template <int Dim, int Order>
+Eigen::Matrix<double, Dim + 1, 1> CurveKernel<Dim, Order>::ControlPoint(SISLCurve const* curve, int index)
+{
+    Eigen::Matrix<double, Dim + 1, 1> point;
+
+    if(curve->ikind == 2 or curve->ikind == 4) {
+        point = Eigen::Map<const Eigen::Matrix<double, Dim + 1, 1>>(curve->rcoef + index * (Dim + 1));
+    }
+    else {
+        point.template head<Dim>() = Eigen::Map<const Eigen::Matrix<double, Dim, 1>>(curve->ecoef + index * Dim);
+        point[Dim] = 1;
+    }
+
+    return point;
+}
+
+
+template <int Dim, int Order>
+void CurveKernel<Dim, Order>::Position(SISLCurve const* curve, double abscissa_s, Eigen::Vector3d& worldF_position) const
+{
+    const int span{FindSpan(curve, abscissa_s)};
+    const double* knots{curve->et};
+
+    // Basis functions (The NURBS Book, A2.2).
+    std::array<double, Order> basis{};
+    std::array<double, Order> left{};
+    std::array<double, Order> right{};
+
+    basis[0] = 1;
+    for(int j = 1; j <= degree_; ++j) {
+        left[j] = abscissa_s - knots[span + 1 - j];
+        right[j] = knots[span + j] - abscissa_s;
+        double saved{0};
+        for(int r = 0; r < j; ++r) {
+            double temp{basis[r] / (right[r + 1] + left[j - r])};
+            basis[r] = saved + right[r + 1] * temp;
+            saved = left[j - r] * temp;
+        }
+        basis[j] = saved;
+    }
+
+    Eigen::Matrix<double, Dim + 1, 1> point{Eigen::Matrix<double, Dim + 1, 1>::Zero()};
+    for(int j = 0; j < Order; ++j)
+        point += basis[j] * ControlPoint(curve, span - degree_ + j);
+
+    worldF_position.setZero();
+    worldF_position.template head<Dim>() = point.template head<Dim>() / point[Dim];
+}
+
+
+template <int Dim, int Order>
+void CurveKernel<Dim, Order>::Derivatives(SISLCurve const* curve, int order, double abscissa_s,
+    std::vector<Eigen::Vector3d>& derivatives) const
+{
+    const int span{FindSpan(curve, abscissa_s)};
+    const double* knots{curve->et};
+    const int basisOrder{std::min(order, degree_)}; // Higher derivatives of the basis functions vanish
+
+    // Basis functions and their derivatives (The NURBS Book, A2.3).
+    std::array<std::array<double, Order>, Order> ndu{};
+    std::array<std::array<double, Order>, Order> ders{};
+    std::array<std::array<double, Order>, 2> a{};
+    std::array<double, Order> left{};
+    std::array<double, Order> right{};
+
+    ndu[0][0] = 1;
+    for(int j = 1; j <= degree_; ++j) {
+        left[j] = abscissa_s - knots[span + 1 - j];
+        right[j] = knots[span + j] - abscissa_s;
+        double saved{0};
+        for(int r = 0; r < j; ++r) {
+            ndu[j][r] = right[r + 1] + left[j - r];
+            double temp{ndu[r][j - 1] / ndu[j][r]};
+            ndu[r][j] = saved + right[r + 1] * temp;
+            saved = left[j - r] * temp;
+        }
+        ndu[j][j] = saved;
+    }
+
+    for(int j = 0; j <= degree_; ++j)
+        ders[0][j] = ndu[j][degree_];
+
+    for(int r = 0; r <= degree_; ++r) {
+        int s1{0};
+        int s2{1};
+        a[0][0] = 1;
+        for(int k = 1; k <= basisOrder; ++k) {
+            double d{0};
+            const int rk{r - k};
+            const int pk{degree_ - k};
+            if(r >= k) {
+                a[s2][0] = a[s1][0] / ndu[pk + 1][rk];
+                d = a[s2][0] * ndu[rk][pk];
+            }
+            const int j1{rk >= -1 ? 1 : -rk};
+            const int j2{r - 1 <= pk ? k - 1 : degree_ - r};
+            for(int j = j1; j <= j2; ++j) {
+                a[s2][j] = (a[s1][j] - a[s1][j - 1]) / ndu[pk + 1][rk + j];
+                d += a[s2][j] * ndu[rk + j][pk];
+            }
+            if(r <= pk) {
+                a[s2][k] = -a[s1][k - 1] / ndu[pk + 1][r];
+                d += a[s2][k] * ndu[r][pk];
+            }
+            ders[k][r] = d;
+            std::swap(s1, s2);
+        }
+    }
+
+    double factor{static_cast<double>(degree_)};
+    for(int k = 1; k <= basisOrder; ++k) {
+        for(int j = 0; j <= degree_; ++j)
+            ders[k][j] *= factor;
+        factor *= (degree_ - k);
+    }
+
+    // Derivatives of the homogeneous curve.
+    std::array<Eigen::Matrix<double, Dim + 1, 1>, Order> homogeneous;
+    for(int k = 0; k <= basisOrder; ++k) {
+        homogeneous[k].setZero();
+        for(int j = 0; j <= degree_; ++j)
+            homogeneous[k] += ders[k][j] * ControlPoint(curve, span - degree_ + j);
+    }
+
+    // Derivatives of the rational curve (The NURBS Book, A4.2), the homogeneous ones vanish beyond basisOrder.
+    std::vector<Eigen::Matrix<double, Dim, 1>, Eigen::aligned_allocator<Eigen::Matrix<double, Dim, 1>>> points(order + 1);
+    const double weight{homogeneous[0][Dim]};
+    for(int k = 0; k <= order; ++k) {
+        Eigen::Matrix<double, Dim, 1> value{Eigen::Matrix<double, Dim, 1>::Zero()};
+        if(k <= basisOrder)
+            value = homogeneous[k].template head<Dim>();
+        double binomial{1};
+        for(int i = 1; i <= std::min(k, basisOrder); ++i) {
+            binomial = binomial * (k - i + 1) / i;
+            value -= binomial * homogeneous[i][Dim] * points[k - i];
+        }
+        points[k] = value / weight;
+    }
+
+    derivatives.resize(order + 1);
+    for(int k = 0; k <= order; ++k) {
+        derivatives[k].setZero();
+        derivatives[k].template head<Dim>() = points[k];
+    }
+}
+
+
+template class CurveKernel<2, 2>;
+template class CurveKernel<3, 2>;
+template class CurveKernel<3, 3>;
+template class CurveKernel<3, 4>;
+
+
+void SislCurveKernel::Position(SISLCurve const* curve, double abscissa_s, Eigen::Vector3d& worldF_position) const
+{
+    if(curve == nullptr)
+        throw std::runtime_error("[SislCurveKernel::Position] The curve has no SISL representation");
+
+    std::vector<double> position(curve->idim, 0);
+    int left{0}; // The SISL routine needs this variable, but it does not use the value.
+    int status{0};
+
+    s1221(const_cast<SISLCurve*>(curve), 0, abscissa_s, &left, &position[0], &status);
+
+    worldF_position.setZero();
+    for(int c = 0; c < std::min(curve->idim, 3); ++c)
+        worldF_position[c] = position[c];
+}
+
+
+void SislCurveKernel::Derivatives(SISLCurve const* curve, int order, double abscissa_s, std::vector<Eigen::Vector3d>& derivatives) const
+{
+    if(curve == nullptr)
+        throw std::runtime_error("[SislCurveKernel::Derivatives] The curve has no SISL representation");
+
+    const int dimension{curve->idim};
+    std::vector<double> derivativesTmp((order + 1) * dimension, 0);
+    int left{0}; // The SISL routine needs this variable, but it does not use the value.
+    int status{0};
+
+    s1221(const_cast<SISLCurve*>(curve), order, abscissa_s, &left, &derivativesTmp[0], &status);
+
+    derivatives.resize(order + 1);
+    for(int k = 0; k <= order; ++k) {
+        derivatives[k].setZero();
+        for(int c = 0; c < std::min(dimension, 3); ++c)
+            derivatives[k][c] = derivativesTmp[k * dimension + c];
+    }
+}
+
+
+CurveKernelInterface const& CurveKernelInterface::Select(SISLCurve const* curve)
+{
+    static const CurveKernel<2, 2> kernel22{};
+    static const CurveKernel<3, 2> kernel32{};
+    static const CurveKernel<3, 3> kernel33{};
+    static const CurveKernel<3, 4> kernel34{};
+    static const SislCurveKernel sislKernel{};
+
+    if(curve == nullptr)
+        return sislKernel;
+
+    if(curve->idim == 2 and curve->ik == 2)
+        return kernel22;
+    if(curve->idim == 3 and curve->ik == 2)
+        return kernel32;
+    if(curve->idim == 3 and curve->ik == 3)
+        return kernel33;
+    if(curve->idim == 3 and curve->ik == 4)
+        return kernel34;
+
+    return sislKernel;
+}
@@ -0,0 +1,141 @@
+#include "sisl_toolbox/frame_table.hpp"
+
+#include "sisl_toolbox/path.hpp"
+#include "sisl_toolbox/curve.hpp"
+
+#include <cmath>
+#include <exception>
+
+
+FrameTable::FrameTable(std::shared_ptr<Path> path, double step)
+    : step_{step}
+    , startParameter_m_{0}
+    , endParameter_m_{0}
+{
+    if(path == nullptr or path->CurvesNumber() == 0)
+        throw std::runtime_error("[FrameTable::FrameTable] Input parameter error. Empty path");
+    if(step <= 0)
+        throw std::runtime_error("[FrameTable::FrameTable] Input parameter error. step must be positive");
+
+    startParameter_m_ = path->StartParameter();
+    endParameter_m_ = path->EndParameter();
+
+    const int samples{static_cast<int>(std::ceil((endParameter_m_ - startParameter_m_) / step_)) + 1};
+    frames_.reserve(samples);
+
+    // Walk the curves along with the abscissa grid, avoiding a path to curve abscissa conversion for each sample.
+    auto const& curves = path->Curves();
+    std::size_t curveId{0};
+    double curveStart_m{startParameter_m_};
+
+    Eigen::Vector3d previousPosition{};
+    Eigen::Vector3d previousTangent{};
+    Eigen::Vector3d previousNormal{};
+
+    for(int i = 0; i < samples; ++i) {
+
+        double abscissa_m{std::min(startParameter_m_ + i * step_, endParameter_m_)};
+
+        while(curveId < curves.size() - 1 and abscissa_m > curveStart_m + curves[curveId]->Length()) {
+            curveStart_m += curves[curveId]->Length();
+            ++curveId;
+        }
+
+        auto const& curve = curves[curveId];
+        double abscissaCurve_m{std::min(curve->StartParameter_m() + (abscissa_m - curveStart_m), curve->EndParameter_m())};
+
+        Eigen::Vector3d position{};
+        Eigen::Vector3d tangent{};
+        Eigen::Vector3d normal{};
+        Eigen::Vector3d binormal{};
+
+        try {
+            position = curve->At(abscissaCurve_m);
+            curve->EvalTangentFrame(abscissaCurve_m, tangent, normal, binormal);
+        } catch (std::runtime_error const& exception) {
+            throw std::runtime_error(std::string("[FrameTable::FrameTable] -> ") + exception.what());
+        }
+        tangent.normalize();
+
+        if(i == 0) {
+            normal = tangent.cross(-Eigen::Vector3d::UnitZ());
+            if(normal.norm() < 1e-9) // Vertical tangent: any direction orthogonal to it
+                normal = tangent.unitOrthogonal();
+            normal.normalize();
+        }
+        else {
+            // Double reflection: reflect the previous frame on the bisector plane of the two positions, then on the one 
+            // of the reflected tangent and the current tangent.
+            normal = previousNormal;
+            Eigen::Vector3d reflectedTangent{previousTangent};
+
+            Eigen::Vector3d v1{position - previousPosition};
+            double c1{v1.dot(v1)};
+            if(c1 > 1e-18) {
+                normal -= (2 / c1) * v1.dot(normal) * v1;
+                reflectedTangent -= (2 / c1) * v1.dot(reflectedTangent) * v1;
+            }
+
+            Eigen::Vector3d v2{tangent - reflectedTangent};
+            double c2{v2.dot(v2)};
+            if(c2 > 1e-18)
+                normal -= (2 / c2) * v2.dot(normal) * v2;
+
+            // Remove the round off drift.
+            normal = (normal - normal.dot(tangent) * tangent).normalized();
+        }
+        binormal = tangent.cross(normal);
+
+        Eigen::Matrix3d rotation{};
+        rotation << tangent, normal, binormal;
+        Eigen::Quaterniond frame{rotation};
+
+        // Keep the quaternions on the same hemisphere so that the slerp takes the short way.
+        if(i > 0 and frames_.back().dot(frame) < 0)
+            frame.coeffs() = -frame.coeffs();
+
+        frames_.push_back(frame);
+
+        previousPosition = position;
+        previousTangent = tangent;
+        previousNormal = normal;
+    }
+}
+
+
+Eigen::Quaterniond FrameTable::Eval(double abscissa_m) const
+{
+    if(abscissa_m < startParameter_m_)
+        throw std::runtime_error("[FrameTable::Eval] Input parameter error. abscissa_m before startParameter_m_");
+    if(abscissa_m > endParameter_m_)
+        throw std::runtime_error("[FrameTable::Eval] Input parameter error. abscissa_m beyond endParameter_m_");
+
+    if(frames_.size() == 1)
+        return frames_.front();
+
+    double position{(abscissa_m - startParameter_m_) / step_};
+    std::size_t index{std::min(static_cast<std::size_t>(position), frames_.size() - 2)};
+
+    // The last interval can be shorter than step_.
+    double intervalStart{startParameter_m_ + index * step_};
+    double intervalLength{std::min(step_, endParameter_m_ - intervalStart)};
+    double t{intervalLength > 0 ? std::min((abscissa_m - intervalStart) / intervalLength, 1.0) : 0.0};
+
+    return frames_[index].slerp(t, frames_[index + 1]);
+}
+
+
+void FrameTable::EvalTangentFrame(double abscissa_m, Eigen::Vector3d& tangent, Eigen::Vector3d& normal, Eigen::Vector3d& binormal) const
+{
+    Eigen::Matrix3d rotation{};
+
+    try {
+        rotation = Eval(abscissa_m).toRotationMatrix();
+    } catch (std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[FrameTable::EvalTangentFrame] -> ") + exception.what());
+    }
+
+    tangent = rotation.col(0);
+    normal = rotation.col(1);
+    binormal = rotation.col(2);
+}
@@ -1,6 +1,14 @@
 #include "sisl_toolbox/generic_curve.hpp"
 #include "sisl.h"
 
+#include <array>
+#include <algorithm>
+#include <cmath>
+
+constexpr int GenericCurve::maxDegree_;
+constexpr int GenericCurve::batchLanes_;
+
+
 GenericCurve::GenericCurve(int degree, std::vector<double> knots, std::vector<Eigen::Vector3d> points, std::vector<double> weights, 
     std::vector<double> coefficients, int dimension, int order)
     : Curve(dimension, order)
@@ -10,21 +18,6 @@ GenericCurve::GenericCurve(int degree, std::vector<double> knots, std::vector<Ei
     , weights_{weights}
     , coefficients_{coefficients}
     {
-        name_ = "Generic Curve";
-        startParameter_s_ = 0;
-
-        int kind{2}; /* Type of curve.
-                    = 1 : Polynomial B-spline curve.
-                    = 2 : Rational B-spline (nurbs) curve.
-                    = 3 : Polynomial Bezier curve.
-                    = 4 : Rational Bezier curve*/
-
-        int copy{1}; /* Flag
-                    = 0 : Set pointer to input arrays.
-                    = 1 : Copy input arrays.
-                    = 2 : Set pointer and remember to free arrays. */
-
-
         if(coefficients_.empty()) {
             for(std::size_t i = 0; i < points_.size(); ++i) {
                 coefficients_.push_back(points_[i][0] * weights_[i]);
@@ -34,22 +27,425 @@ GenericCurve::GenericCurve(int degree, std::vector<double> knots, std::vector<Ei
             }
         }
 
-        curve_ = newCurve(points_.size(), degree_ + 1, &knots_[0], &coefficients_[0], kind, Dimension(), copy);
+        BuildSislCurve();
+    }
+
+
+GenericCurve::GenericCurve(std::vector<Eigen::Vector3d> const& samples, double tolerance, int degree, int maxControlPoints, 
+    int dimension, int order)
+    : Curve(dimension, order)
+    , degree_{degree}
+    {
+        const int samplesNumber{static_cast<int>(samples.size())};
+
+        if(degree_ < 1 or degree_ > maxDegree_)
+            throw std::runtime_error("[GenericCurve::GenericCurve] Input parameter error. degree must be in [1, " 
+                + std::to_string(maxDegree_) + "]");
+        if(samplesNumber < degree_ + 1)
+            throw std::runtime_error("[GenericCurve::GenericCurve] Input parameter error. At least degree + 1 samples are needed");
+        if(tolerance <= 0)
+            throw std::runtime_error("[GenericCurve::GenericCurve] Input parameter error. tolerance must be positive");
+        if(maxControlPoints <= 0 or maxControlPoints > samplesNumber)
+            maxControlPoints = samplesNumber;
+
+        // Chord length parametrization.
+        std::vector<double> parameters(samplesNumber, 0);
+        for(int j = 1; j < samplesNumber; ++j)
+            parameters[j] = parameters[j - 1] + (samples[j] - samples[j - 1]).norm();
+
+        const double totalLength{parameters.back()};
+        if(totalLength == 0)
+            throw std::runtime_error("[GenericCurve::GenericCurve] Input parameter error. All the samples are coincident");
+
+        std::vector<double> breakpoints{0, totalLength};
+        std::vector<Eigen::Vector3d> controlPoints;
+        std::vector<double> knots;
+        std::array<double, maxDegree_ + 1> basis{};
+
+        while(true) {
+
+            // Clamped knot vector on the current breakpoints.
+            knots.assign(degree_, 0);
+            knots.insert(knots.end(), breakpoints.begin(), breakpoints.end());
+            knots.insert(knots.end(), degree_, totalLength);
+
+            controlPoints = FitControlPoints(samples, parameters, knots, degree_);
+
+            // Maximum error on each span (the samples are sorted by parameter, the span index only increases).
+            const int spans{static_cast<int>(breakpoints.size()) - 1};
+            std::vector<double> spanErrors(spans, 0);
+            int span{degree_};
+            const int lastSpan{static_cast<int>(controlPoints.size()) - 1};
+            fittingError_ = 0;
+
+            for(int j = 0; j < samplesNumber; ++j) {
+                while(span < lastSpan and parameters[j] >= knots[span + 1])
+                    ++span;
+                BasisFunctions(span, parameters[j], degree_, knots, &basis[0]);
+
+                Eigen::Vector3d point{Eigen::Vector3d::Zero()};
+                for(int k = 0; k <= degree_; ++k)
+                    point += basis[k] * controlPoints[span - degree_ + k];
+
+                double error{(point - samples[j]).norm()};
+                spanErrors[span - degree_] = std::max(spanErrors[span - degree_], error);
+                fittingError_ = std::max(fittingError_, error);
+            }
+
+            if(fittingError_ <= tolerance)
+                break;
+
+            // Halve the spans above tolerance, within the control points budget.
+            int budget{maxControlPoints - static_cast<int>(controlPoints.size())};
+            std::vector<double> refined{breakpoints.front()};
+            for(int i = 0; i < spans; ++i) {
+                if(spanErrors[i] > tolerance and budget > 0) {
+                    refined.push_back(0.5 * (breakpoints[i] + breakpoints[i + 1]));
+                    --budget;
+                }
+                refined.push_back(breakpoints[i + 1]);
+            }
+
+            if(refined.size() == breakpoints.size())
+                break;
+
+            breakpoints = std::move(refined);
+        }
+
+        knots_ = knots;
+        points_ = controlPoints;
+        weights_.assign(points_.size(), 1.0);
+        coefficients_.reserve(4 * points_.size());
+        for(auto const& point: points_) {
+            coefficients_.insert(coefficients_.end(), {point[0], point[1], point[2], 1.0});
+        }
+
+        BuildSislCurve();
+    }
+
+
+void GenericCurve::BuildSislCurve()
+{
+    name_ = "Generic Curve";
+    startParameter_s_ = 0;
+
+    int kind{2}; /* Type of curve.
+                = 1 : Polynomial B-spline curve.
+                = 2 : Rational B-spline (nurbs) curve.
+                = 3 : Polynomial Bezier curve.
+                = 4 : Rational Bezier curve*/
+
+    int copy{1}; /* Flag
+                = 0 : Set pointer to input arrays.
+                = 1 : Copy input arrays.
+                = 2 : Set pointer and remember to free arrays. */
+
+    curve_ = newCurve(points_.size(), degree_ + 1, &knots_[0], &coefficients_[0], kind, Dimension(), copy);
+    BindKernel();
+
+    // Pick parameters range of the curve.
+    s1363(curve_, &startParameter_s_, &endParameter_s_, &statusFlag_);
+
+    // Pick curve length.
+    // s1240(curve_, Epsge(), &endParameter_m_, &statusFlag_);             
+    s1240(curve_, Epsge(), &length_, &statusFlag_);  
+
+    try {
+        FromAbsSislToPos(startParameter_s_, startPoint_);
+        FromAbsSislToPos(endParameter_s_, endPoint_);
+    } catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string{"[Curve::Curve] -> "} + exception.what());
+    }
+
+    startParameter_m_ = startParameter_s_ * (length_ / (endParameter_s_ - startParameter_s_));
+    endParameter_m_ = endParameter_s_ * (length_ / (endParameter_s_ - startParameter_s_));
+
+    CacheEndpointData();
+}
+
+
+std::vector<Eigen::Vector3d> GenericCurve::BatchAt(std::vector<double> const& abscissae_m) const
+{
+    const double minAbscissa_m{std::min(startParameter_m_, endParameter_m_)};
+    const double maxAbscissa_m{std::max(startParameter_m_, endParameter_m_)};
+    const double scale{(endParameter_s_ - startParameter_s_) / length_};
+
+    std::vector<double> abscissae_s(abscissae_m.size());
+    for(std::size_t i = 0; i < abscissae_m.size(); ++i) {
+        if(abscissae_m[i] < minAbscissa_m)
+            throw std::runtime_error("[GenericCurve::BatchAt] Input parameter error. abscissa_m before startParameter_m_");
+        if(abscissae_m[i] > maxAbscissa_m)
+            throw std::runtime_error("[GenericCurve::BatchAt] Input parameter error. abscissa_m beyond endParameter_m_");
+        abscissae_s[i] = abscissae_m[i] * scale;
+    }
+
+    std::vector<Eigen::Vector3d> points;
+    EvaluateSisl(abscissae_s, points);
+
+    return points;
+}
+
+
+std::shared_ptr<std::vector<Eigen::Vector3d>> GenericCurve::Sampling(int const samples) const
+{
+    std::vector<double> abscissae_s(samples);
+    for(int k = 0; k < samples; ++k) {
+        abscissae_s[k] = startParameter_s_ + static_cast<double>(k) / (samples - 1) * (endParameter_s_ - startParameter_s_);
+    }
+
+    auto curve = std::make_shared<std::vector<Eigen::Vector3d>>();
+    EvaluateSisl(abscissae_s, *curve);
+
+    return curve;
+}
+
+
+void GenericCurve::Reverse()
+{
+    Curve::Reverse();
+
+    // Same as s1706(): the knots are mirrored on the parameter interval, the control points are taken in reverse order.
+    const double knotsSum{knots_.front() + knots_.back()};
+    std::reverse(knots_.begin(), knots_.end());
+    for(auto& knot: knots_)
+        knot = knotsSum - knot;
+
+    std::reverse(points_.begin(), points_.end());
+    std::reverse(weights_.begin(), weights_.end());
+
+    const std::size_t stride{static_cast<std::size_t>(Dimension()) + 1};
+    const std::size_t controlPointsNumber{coefficients_.size() / stride};
+    for(std::size_t i = 0; i < controlPointsNumber / 2; ++i) {
+        std::swap_ranges(coefficients_.begin() + i * stride, coefficients_.begin() + (i + 1) * stride, 
+            coefficients_.begin() + (controlPointsNumber - 1 - i) * stride);
+    }
+}
+
+
+void GenericCurve::EvaluateSisl(std::vector<double> const& abscissae_s, std::vector<Eigen::Vector3d>& points) const
+{
+    const int dimension{Dimension()};
+    const int stride{dimension + 1}; // Rational curve: homogeneous coefficients
+    const int firstSpan{degree_};
+    const int lastSpan{static_cast<int>(coefficients_.size()) / stride - 1};
+    const double* knots{knots_.data()};
+    const double* coefficients{coefficients_.data()};
+    const std::size_t abscissaeNumber{abscissae_s.size()};
+
+    if(stride > 4)
+        throw std::runtime_error("[GenericCurve::EvaluateSisl] Only curves with dimension up to 3 can be evaluated");
+
+    points.resize(abscissaeNumber);
+
+    // Lane buffers: [basis function / coordinate][lane]
+    alignas(64) double parameter[batchLanes_];
+    alignas(64) double basis[maxDegree_ + 1][batchLanes_];
+    alignas(64) double left[maxDegree_ + 1][batchLanes_];
+    alignas(64) double right[maxDegree_ + 1][batchLanes_];
+    alignas(64) double saved[batchLanes_];
+    alignas(64) double homogeneous[4][batchLanes_];
+    int span[batchLanes_];
+
+    int currentSpan{firstSpan};
+    double previousParameter{knots[firstSpan]};
+
+    for(std::size_t first = 0; first < abscissaeNumber; first += batchLanes_) {
+
+        const int count{static_cast<int>(std::min<std::size_t>(batchLanes_, abscissaeNumber - first))};
+
+        // Knot spans: merge pass while the parameters are sorted, binary search where the order breaks.
+        for(int lane = 0; lane < batchLanes_; ++lane) {
+            if(lane >= count) {
+                parameter[lane] = parameter[0];
+                span[lane] = span[0];
+                continue;
+            }
+            const double u{abscissae_s[first + lane]};
+            if(u < previousParameter) {
+                currentSpan = static_cast<int>(std::upper_bound(knots + firstSpan, knots + lastSpan + 1, u) - knots) - 1;
+                currentSpan = std::max(firstSpan, std::min(currentSpan, lastSpan));
+            }
+            while(currentSpan < lastSpan and u >= knots[currentSpan + 1])
+                ++currentSpan;
+
+            parameter[lane] = u;
+            span[lane] = currentSpan;
+            previousParameter = u;
+        }
+
+        // Basis functions (The NURBS Book, A2.2) for all the lanes at once.
+        #pragma omp simd
+        for(int lane = 0; lane < batchLanes_; ++lane)
+            basis[0][lane] = 1;
 
-        // Pick parameters range of the curve.
-        s1363(curve_, &startParameter_s_, &endParameter_s_, &statusFlag_);
+        for(int j = 1; j <= degree_; ++j) {
+            #pragma omp simd
+            for(int lane = 0; lane < batchLanes_; ++lane) {
+                left[j][lane] = parameter[lane] - knots[span[lane] + 1 - j];
+                right[j][lane] = knots[span[lane] + j] - parameter[lane];
+                saved[lane] = 0;
+            }
+            for(int r = 0; r < j; ++r) {
+                #pragma omp simd
+                for(int lane = 0; lane < batchLanes_; ++lane) {
+                    const double temp{basis[r][lane] / (right[r + 1][lane] + left[j - r][lane])};
+                    basis[r][lane] = saved[lane] + right[r + 1][lane] * temp;
+                    saved[lane] = left[j - r][lane] * temp;
+                }
+            }
+            #pragma omp simd
+            for(int lane = 0; lane < batchLanes_; ++lane)
+                basis[j][lane] = saved[lane];
+        }
 
-        // Pick curve length.
-        // s1240(curve_, Epsge(), &endParameter_m_, &statusFlag_);             
-        s1240(curve_, Epsge(), &length_, &statusFlag_);  
+        // Homogeneous point.
+        for(int c = 0; c < stride; ++c) {
+            #pragma omp simd
+            for(int lane = 0; lane < batchLanes_; ++lane)
+                homogeneous[c][lane] = 0;
+
+            for(int k = 0; k <= degree_; ++k) {
+                #pragma omp simd
+                for(int lane = 0; lane < batchLanes_; ++lane)
+                    homogeneous[c][lane] += basis[k][lane] * coefficients[(span[lane] - degree_ + k) * stride + c];
+            }
+        }
 
-        try {
-            FromAbsSislToPos(startParameter_s_, startPoint_);
-            FromAbsSislToPos(endParameter_s_, endPoint_);
-        } catch(std::runtime_error const& exception) {
-            throw std::runtime_error(std::string{"[Curve::Curve] -> "} + exception.what());
+        // Homogeneous divide.
+        #pragma omp simd
+        for(int lane = 0; lane < batchLanes_; ++lane) {
+            const double inverseWeight{1.0 / homogeneous[dimension][lane]};
+            for(int c = 0; c < dimension; ++c)
+                homogeneous[c][lane] *= inverseWeight;
         }
 
-        startParameter_m_ = startParameter_s_ * (length_ / (endParameter_s_ - startParameter_s_));
-        endParameter_m_ = endParameter_s_ * (length_ / (endParameter_s_ - startParameter_s_));
-    }
\ No newline at end of file
+        for(int lane = 0; lane < count; ++lane) {
+            Eigen::Vector3d& point{points[first + lane]};
+            point.setZero();
+            for(int c = 0; c < dimension; ++c)
+                point[c] = homogeneous[c][lane];
+        }
+    }
+}
+
+
+void GenericCurve::BasisFunctions(int span, double parameter, int degree, std::vector<double> const& knots, double* basis)
+{
+    std::array<double, maxDegree_ + 1> left{};
+    std::array<double, maxDegree_ + 1> right{};
+
+    basis[0] = 1;
+    for(int j = 1; j <= degree; ++j) {
+        left[j] = parameter - knots[span + 1 - j];
+        right[j] = knots[span + j] - parameter;
+        double saved{0};
+        for(int r = 0; r < j; ++r) {
+            double temp{basis[r] / (right[r + 1] + left[j - r])};
+            basis[r] = saved + right[r + 1] * temp;
+            saved = left[j - r] * temp;
+        }
+        basis[j] = saved;
+    }
+}
+
+
+std::vector<Eigen::Vector3d> GenericCurve::FitControlPoints(std::vector<Eigen::Vector3d> const& samples, 
+    std::vector<double> const& parameters, std::vector<double> const& knots, int degree)
+{
+    const int samplesNumber{static_cast<int>(samples.size())};
+    const int controlPointsNumber{static_cast<int>(knots.size()) - degree - 1};
+
+    std::vector<Eigen::Vector3d> controlPoints(controlPointsNumber, Eigen::Vector3d::Zero());
+    controlPoints.front() = samples.front();
+    controlPoints.back() = samples.back();
+
+    // Unknowns: the inner control points 1 .. controlPointsNumber - 2.
+    const int unknowns{controlPointsNumber - 2};
+    if(unknowns <= 0)
+        return controlPoints;
+
+    // Symmetric banded normal matrix, band[i][d] = A(i, i + d).
+    const int bandwidth{std::max(degree, 2)};
+    std::vector<std::array<double, maxDegree_ + 1>> band(unknowns);
+    for(auto& row: band)
+        row.fill(0);
+    std::vector<Eigen::Vector3d> rhs(unknowns, Eigen::Vector3d::Zero());
+
+    auto addTerm = [&](int const* indices, double const* values, int count, Eigen::Vector3d const& target, double weight) {
+        // Contribution of weight * (sum_k values[k] * c[indices[k]] - target)^2.
+        Eigen::Vector3d residual{target};
+        for(int k = 0; k < count; ++k) {
+            if(indices[k] == 0 or indices[k] == controlPointsNumber - 1)
+                residual -= values[k] * controlPoints[indices[k]];
+        }
+        for(int a = 0; a < count; ++a) {
+            int row{indices[a] - 1};
+            if(row < 0 or row >= unknowns)
+                continue;
+            rhs[row] += weight * values[a] * residual;
+            for(int b = 0; b < count; ++b) {
+                int column{indices[b] - 1};
+                if(column >= row and column < unknowns)
+                    band[row][column - row] += weight * values[a] * values[b];
+            }
+        }
+    };
+
+    std::array<double, maxDegree_ + 1> basis{};
+    std::array<int, maxDegree_ + 1> indices{};
+    int span{degree};
+
+    for(int j = 0; j < samplesNumber; ++j) {
+        while(span < controlPointsNumber - 1 and parameters[j] >= knots[span + 1])
+            ++span;
+        BasisFunctions(span, parameters[j], degree, knots, &basis[0]);
+        for(int k = 0; k <= degree; ++k)
+            indices[k] = span - degree + k;
+        addTerm(&indices[0], &basis[0], degree + 1, samples[j], 1.0);
+    }
+
+    // Second difference penalty, light w.r.t. the data term.
+    const double smoothing{1e-6 * std::max(1.0, static_cast<double>(samplesNumber) / controlPointsNumber)};
+    const std::array<double, 3> difference{1, -2, 1};
+    for(int i = 1; i < controlPointsNumber - 1; ++i) {
+        std::array<int, 3> triple{i - 1, i, i + 1};
+        addTerm(&triple[0], &difference[0], 3, Eigen::Vector3d::Zero(), smoothing);
+    }
+
+    // Banded Cholesky factorization A = L L^T, L stored in place (band[i][d] = L(i + d, i)).
+    for(int i = 0; i < unknowns; ++i) {
+        for(int d = 0; d <= bandwidth and i + d < unknowns; ++d) {
+            double sum{band[i][d]};
+            for(int k = std::max(0, i + d - bandwidth); k < i; ++k) {
+                if(i - k <= bandwidth)
+                    sum -= band[k][i - k] * band[k][i + d - k];
+            }
+            if(d == 0) {
+                if(sum <= 0)
+                    throw std::runtime_error("[GenericCurve::FitControlPoints] Singular normal equations");
+                band[i][0] = std::sqrt(sum);
+            }
+            else {
+                band[i][d] = sum / band[i][0];
+            }
+        }
+    }
+
+    // Forward and backward substitutions.
+    std::vector<Eigen::Vector3d> solution(rhs);
+    for(int i = 0; i < unknowns; ++i) {
+        for(int k = std::max(0, i - bandwidth); k < i; ++k)
+            solution[i] -= band[k][i - k] * solution[k];
+        solution[i] /= band[i][0];
+    }
+    for(int i = unknowns - 1; i >= 0; --i) {
+        for(int d = 1; d <= bandwidth and i + d < unknowns; ++d)
+            solution[i] -= band[i][d] * solution[i + d];
+        solution[i] /= band[i][0];
+    }
+
+    for(int i = 0; i < unknowns; ++i)
+        controlPoints[i + 1] = solution[i];
+
+    return controlPoints;
+}
@@ -0,0 +1,157 @@
+#include "sisl_toolbox/geodetic_frame.hpp"
+
+constexpr double GeodeticFrame::semiMajorAxis_;
+constexpr double GeodeticFrame::flattening_;
+constexpr double GeodeticFrame::eccentricity2_;
+constexpr double GeodeticFrame::smallAngle_;
+constexpr int GeodeticFrame::latitudeIterations_;
+
+
+GeodeticFrame::GeodeticFrame(Eigen::Vector3d const& origin)
+    : origin_{origin}
+    , latitude0_{origin[0] * M_PI / 180.0}
+    , longitude0_{origin[1] * M_PI / 180.0}
+    , altitude0_{origin[2]}
+{
+    sinLat0_ = std::sin(latitude0_);
+    cosLat0_ = std::cos(latitude0_);
+    tanLat0_ = sinLat0_ / cosLat0_;
+
+    double denominator{1 - eccentricity2_ * sinLat0_ * sinLat0_};
+    primeVerticalRadius0_ = semiMajorAxis_ / std::sqrt(denominator);
+    meridianRadius0_ = semiMajorAxis_ * (1 - eccentricity2_) / (denominator * std::sqrt(denominator));
+
+    radial0_ = (primeVerticalRadius0_ + altitude0_) * cosLat0_;
+    axial0_ = (primeVerticalRadius0_ * (1 - eccentricity2_) + altitude0_) * sinLat0_;
+}
+
+
+Eigen::Vector3d GeodeticFrame::ToENU(Eigen::Vector3d const& geodeticPoint) const
+{
+    double deltaLat{geodeticPoint[0] * M_PI / 180.0 - latitude0_};
+    double deltaLon{std::remainder(geodeticPoint[1] * M_PI / 180.0 - longitude0_, 2 * M_PI)};
+
+    Eigen::Vector3d enuPoint{};
+    Forward(std::sin(deltaLat), std::cos(deltaLat), std::sin(deltaLon), std::cos(deltaLon), geodeticPoint[2], 
+        enuPoint[0], enuPoint[1], enuPoint[2]);
+
+    return enuPoint;
+}
+
+
+Eigen::Vector3d GeodeticFrame::ToGeodetic(Eigen::Vector3d const& enuPoint) const
+{
+    // Cartesian coordinates in the frame of the origin meridian.
+    double x{radial0_ - sinLat0_ * enuPoint[1] + cosLat0_ * enuPoint[2]};
+    double y{enuPoint[0]};
+    double z{axial0_ + cosLat0_ * enuPoint[1] + sinLat0_ * enuPoint[2]};
+
+    double radial{std::sqrt(x * x + y * y)};
+    double latitude{std::atan2(z, radial * (1 - eccentricity2_))};
+    double altitude{0};
+
+    for(int i = 0; i < 5; ++i) {
+        double sinLat{std::sin(latitude)};
+        double primeVertical{semiMajorAxis_ / std::sqrt(1 - eccentricity2_ * sinLat * sinLat)};
+        altitude = (std::abs(std::cos(latitude)) > 1e-9) ? radial / std::cos(latitude) - primeVertical 
+                                                         : std::abs(z) - primeVertical * (1 - eccentricity2_);
+        latitude = std::atan2(z, radial * (1 - eccentricity2_ * primeVertical / (primeVertical + altitude)));
+    }
+
+    double longitude{std::remainder(longitude0_ + std::atan2(y, x), 2 * M_PI)};
+
+    return Eigen::Vector3d{latitude * 180.0 / M_PI, longitude * 180.0 / M_PI, altitude};
+}
+
+
+std::vector<Eigen::Vector3d> GeodeticFrame::ToENU(std::vector<Eigen::Vector3d> const& geodeticPoints) const
+{
+    const std::size_t size{geodeticPoints.size()};
+    std::vector<Eigen::Vector3d> enuPoints(size);
+
+    // Structure of arrays, so that the main loop has unit stride.
+    std::vector<double> deltaLat(size), deltaLon(size), altitude(size), east(size), north(size), up(size);
+    for(std::size_t i = 0; i < size; ++i) {
+        deltaLat[i] = geodeticPoints[i][0] * M_PI / 180.0 - latitude0_;
+        deltaLon[i] = geodeticPoints[i][1] * M_PI / 180.0 - longitude0_;
+        deltaLon[i] -= 2 * M_PI * std::round(deltaLon[i] / (2 * M_PI));
+        altitude[i] = geodeticPoints[i][2];
+    }
+
+    #pragma omp simd
+    for(std::size_t i = 0; i < size; ++i) {
+        Forward(SmallAngleSin(deltaLat[i]), SmallAngleCos(deltaLat[i]), SmallAngleSin(deltaLon[i]), SmallAngleCos(deltaLon[i]), 
+            altitude[i], east[i], north[i], up[i]);
+    }
+
+    for(std::size_t i = 0; i < size; ++i) {
+        if(std::abs(deltaLat[i]) > smallAngle_ or std::abs(deltaLon[i]) > smallAngle_)
+            enuPoints[i] = ToENU(geodeticPoints[i]);
+        else
+            enuPoints[i] = Eigen::Vector3d{east[i], north[i], up[i]};
+    }
+
+    return enuPoints;
+}
+
+
+std::vector<Eigen::Vector3d> GeodeticFrame::ToGeodetic(std::vector<Eigen::Vector3d> const& enuPoints) const
+{
+    const std::size_t size{enuPoints.size()};
+    std::vector<Eigen::Vector3d> geodeticPoints(size);
+
+    std::vector<double> east(size), north(size), up(size), deltaLat(size), deltaLon(size), altitude(size);
+    std::vector<int> exact(size);
+    for(std::size_t i = 0; i < size; ++i) {
+        east[i] = enuPoints[i][0];
+        north[i] = enuPoints[i][1];
+        up[i] = enuPoints[i][2];
+    }
+
+    #pragma omp simd
+    for(std::size_t i = 0; i < size; ++i) {
+        // Cartesian coordinates in the frame of the origin meridian.
+        double x{radial0_ - sinLat0_ * north[i] + cosLat0_ * up[i]};
+        double y{east[i]};
+        double z{axial0_ + cosLat0_ * north[i] + sinLat0_ * up[i]};
+        double radial{std::sqrt(x * x + y * y)};
+
+        // Fixed point on the tangent of the latitude: tan = (z + e^2 N sin) / radial.
+        double tanLat{z / (radial * (1 - eccentricity2_))};
+        for(int k = 0; k < latitudeIterations_; ++k) {
+            double sinLat{tanLat / std::sqrt(1 + tanLat * tanLat)};
+            double primeVertical{semiMajorAxis_ / std::sqrt(1 - eccentricity2_ * sinLat * sinLat)};
+            tanLat = (z + eccentricity2_ * primeVertical * sinLat) / radial;
+        }
+
+        double cosLat{1 / std::sqrt(1 + tanLat * tanLat)};
+        double sinLat{tanLat * cosLat};
+        altitude[i] = radial * cosLat + z * sinLat - semiMajorAxis_ * std::sqrt(1 - eccentricity2_ * sinLat * sinLat);
+
+        // The polynomials hold only for small arguments (they wrap back to zero for large ones) and atan(y / x) loses
+        // the quadrant when x <= 0: the guard is on the arguments, not on the results.
+        double latitudeDenominator{1 + tanLat * tanLat0_};
+        double latitudeTan{(tanLat - tanLat0_) / latitudeDenominator};
+        double longitudeTan{y / x};
+        exact[i] = (x <= 0 or latitudeDenominator <= 0 or std::abs(latitudeTan) > smallAngle_ 
+            or std::abs(longitudeTan) > smallAngle_) ? 1 : 0;
+        deltaLat[i] = SmallAngleAtan(latitudeTan);
+        deltaLon[i] = SmallAngleAtan(longitudeTan);
+    }
+
+    for(std::size_t i = 0; i < size; ++i) {
+        if(cosLat0_ < smallAngle_ or exact[i])
+            geodeticPoints[i] = ToGeodetic(enuPoints[i]);
+        else
+            geodeticPoints[i] = Eigen::Vector3d{(latitude0_ + deltaLat[i]) * 180.0 / M_PI, 
+                std::remainder(longitude0_ + deltaLon[i], 2 * M_PI) * 180.0 / M_PI, altitude[i]};
+    }
+
+    return geodeticPoints;
+}
+
+
+std::shared_ptr<std::vector<Eigen::Vector3d>> GeodeticFrame::ToGeodetic(std::shared_ptr<std::vector<Eigen::Vector3d>> enuPoints) const
+{
+    return std::make_shared<std::vector<Eigen::Vector3d>>(ToGeodetic(*enuPoints));
+}
@@ -0,0 +1,120 @@
+#include "sisl_toolbox/length_index.hpp"
+
+#include <stdexcept>
+
+
+void LengthIndex::Build()
+{
+    const int size{Size()};
+
+    tree_.assign(size + 1, 0);
+    for(int i = 1; i <= size; ++i) {
+        tree_[i] += lengths_[i - 1];
+        const int parent{i + (i & -i)};
+        if(parent <= size)
+            tree_[parent] += tree_[i];
+    }
+}
+
+
+void LengthIndex::Assign(std::vector<double> const& lengths)
+{
+    lengths_ = lengths;
+    Build();
+}
+
+
+void LengthIndex::PushBack(double length)
+{
+    if(tree_.empty())
+        tree_.push_back(0);
+
+    // The new node covers (i - lowbit(i), i]: its own length plus the nodes of the previous entries in that range.
+    const int i{Size() + 1};
+    double node{length};
+    for(int j = i - 1; j > i - (i & -i); j -= (j & -j))
+        node += tree_[j];
+
+    lengths_.push_back(length);
+    tree_.push_back(node);
+}
+
+
+void LengthIndex::Update(int id, double length)
+{
+    if(id < 0 or id >= Size())
+        throw std::runtime_error("[LengthIndex::Update] Input parameter error. id out of bound");
+
+    const double delta{length - lengths_[id]};
+    lengths_[id] = length;
+
+    for(int i = id + 1; i <= Size(); i += (i & -i))
+        tree_[i] += delta;
+}
+
+
+void LengthIndex::Splice(int first, int erased, std::vector<double> const& lengths)
+{
+    if(first < 0 or erased < 0 or first + erased > Size())
+        throw std::runtime_error("[LengthIndex::Splice] Input parameter error. Range out of bound");
+
+    // A short append pushes the new nodes, a long one (as a path concatenation) rebuilds the tree once.
+    if(erased == 0 and first == Size() and lengths.size() <= lengths_.size()) {
+        for(auto length: lengths)
+            PushBack(length);
+        return;
+    }
+    // A replacement of as many entries (e.g. the legs of a re-planned coverage path) updates them in place.
+    if(erased == static_cast<int>(lengths.size())) {
+        for(int i = 0; i < erased; ++i)
+            Update(first + i, lengths[i]);
+        return;
+    }
+
+    lengths_.erase(lengths_.begin() + first, lengths_.begin() + first + erased);
+    lengths_.insert(lengths_.begin() + first, lengths.begin(), lengths.end());
+    Build();
+}
+
+
+double LengthIndex::Prefix(int count) const
+{
+    double sum{0};
+    for(int i = count; i > 0; i -= (i & -i))
+        sum += tree_[i];
+
+    return sum;
+}
+
+
+int LengthIndex::Find(double abscissa_m, double& offset_m) const
+{
+    const int size{Size()};
+
+    if(size == 0) {
+        offset_m = abscissa_m;
+        return -1;
+    }
+
+    int highestBit{1};
+    while(2 * highestBit <= size)
+        highestBit *= 2;
+
+    // Descent on the tree: the last position whose cumulative length is before the abscissa.
+    int position{0};
+    double remaining_m{abscissa_m};
+    for(int step = highestBit; step > 0; step /= 2) {
+        if(position + step <= size and tree_[position + step] < remaining_m) {
+            position += step;
+            remaining_m -= tree_[position];
+        }
+    }
+
+    if(position == size) {
+        --position;
+        remaining_m += lengths_[position];
+    }
+
+    offset_m = remaining_m;
+    return position;
+}
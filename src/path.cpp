@@ -1,7 +1,14 @@
 #include "sisl_toolbox/path.hpp"
 
 #include "sisl_toolbox/curve.hpp" 
+#include "sisl_toolbox/straight_line.hpp"
+#include "sisl_toolbox/circular_arc.hpp"
+#include "sisl_toolbox/clothoid.hpp"
+#include "sisl_toolbox/segment_kernel.hpp"
+#include "sisl_toolbox/geometry.hpp"
+#include <algorithm>
 #include <exception>
+#include <limits>
 
 Path::Path()
 : curvesNumber_{0} 
@@ -11,6 +18,96 @@ Path::Path()
 , name_ {""} {}
 
 
+void Path::Splice(int firstCurve, int erasedCurves, std::vector<std::shared_ptr<Curve>> const& curves) {
+
+    // Bring the index up to date (after Reverse) before changing it.
+    Lengths();
+
+    std::vector<double> lengths;
+    lengths.reserve(curves.size());
+    for(auto const& curve: curves)
+        lengths.push_back(curve->Length());
+
+    curves_.erase(curves_.begin() + firstCurve, curves_.begin() + firstCurve + erasedCurves);
+    curves_.insert(curves_.begin() + firstCurve, curves.begin(), curves.end());
+    curvesNumber_ = static_cast<int>(curves_.size());
+
+    lengthIndex_.Splice(firstCurve, erasedCurves, lengths);
+    endParameter_m_ = startParameter_m_ + lengthIndex_.Total();
+    length_ = endParameter_m_ - startParameter_m_;
+
+    // A kernel shared with a copy of the path is left to the copy.
+    if(segmentKernel_ != nullptr and segmentKernel_.use_count() == 1)
+        segmentKernel_->Splice(curves_, firstCurve, erasedCurves, static_cast<int>(curves.size()));
+    else
+        segmentKernel_.reset();
+}
+
+
+LengthIndex const& Path::Lengths() {
+
+    if(not lengthIndexValid_) {
+        std::vector<double> lengths;
+        lengths.reserve(curves_.size());
+        for(auto const& curve: curves_)
+            lengths.push_back(curve->Length());
+        lengthIndex_.Assign(lengths);
+        lengthIndexValid_ = true;
+    }
+
+    return lengthIndex_;
+}
+
+
+void Path::Insert(int curveId, std::shared_ptr<Curve> curve) {
+
+    if(curveId < 0 or curveId > curvesNumber_)
+        throw std::runtime_error("[Path::Insert] Input parameter error. curveId out of bound");
+
+    Splice(curveId, 0, {curve});
+}
+
+
+void Path::Erase(int firstCurve, int count) {
+
+    if(firstCurve < 0 or count < 0 or firstCurve + count > curvesNumber_)
+        throw std::runtime_error("[Path::Erase] Input parameter error. Curves range out of bound");
+
+    Splice(firstCurve, count, {});
+}
+
+
+void Path::Replace(int curveId, std::shared_ptr<Curve> curve) {
+
+    if(curveId < 0 or curveId >= curvesNumber_)
+        throw std::runtime_error("[Path::Replace] Input parameter error. curveId out of bound");
+
+    Splice(curveId, 1, {curve});
+}
+
+
+void Path::Replace(int firstCurve, int count, std::vector<std::shared_ptr<Curve>> const& curves) {
+
+    if(firstCurve < 0 or count < 0 or firstCurve + count > curvesNumber_)
+        throw std::runtime_error("[Path::Replace] Input parameter error. Curves range out of bound");
+
+    Splice(firstCurve, count, curves);
+}
+
+
+void Path::Append(Path const& other) {
+
+    // A copy of the curves when appending the path to itself
+    if(&other == this) {
+        auto const curves = curves_;
+        Splice(curvesNumber_, 0, curves);
+        return;
+    }
+
+    Splice(curvesNumber_, 0, other.curves_);
+}
+
+
 std::tuple<double, int> Path::PathAbsToCurveAbs(double abscissa_m) {
 
     if(abscissa_m < startParameter_m_){
@@ -21,59 +118,51 @@ std::tuple<double, int> Path::PathAbsToCurveAbs(double abscissa_m) {
     }
 
     double abscissaCurve_m{};
-    int curveId{0};
+    double localAbscissa_m{0};
+    int curveId{Lengths().Find(abscissa_m - startParameter_m_, localAbscissa_m)};
 
-    double curveLength {curves_[curveId]->Length()};
+    if(curveId < 0)
+        throw std::runtime_error("[Path::PathAbsToCurveAbs] The path is empty");
 
+    auto const& curve = curves_[curveId];
+    localAbscissa_m = std::min(std::max(localAbscissa_m, 0.0), curve->Length());
 
-    while(abscissa_m > 0) {
-        if(abscissa_m > curveLength and curveId < curvesNumber_) {
-            abscissa_m -= curveLength;
-            ++curveId;
-            curveLength = curves_[curveId]->Length();
+    if(curve->StartParameter_m() >= 0 and curve->EndParameter_m() >= 0) {
+        if(curve->EndParameter_m() >= curve->StartParameter_m()) {
+            abscissaCurve_m = curve->StartParameter_m() + localAbscissa_m;
         }
         else {
-            if(curves_[curveId]->StartParameter_m() >= 0 and curves_[curveId]->EndParameter_m() >= 0) {
-                if(curves_[curveId]->EndParameter_m() >= curves_[curveId]->StartParameter_m()) {
-                    abscissaCurve_m = curves_[curveId]->StartParameter_m() + abscissa_m;
-                }
-                else {
-                    abscissaCurve_m = curves_[curveId]->StartParameter_m() - abscissa_m;
-                }
-            }
-            else if(curves_[curveId]->StartParameter_m() >= 0 and curves_[curveId]->EndParameter_m() <= 0) {
-                abscissaCurve_m = curves_[curveId]->StartParameter_m() - abscissa_m;
-            }
-            else if(curves_[curveId]->StartParameter_m() <= 0 and curves_[curveId]->EndParameter_m() >= 0) {
-                abscissaCurve_m = curves_[curveId]->StartParameter_m() + abscissa_m;
-            }
-            else {
-                if(curves_[curveId]->EndParameter_m() <= curves_[curveId]->StartParameter_m()) {
-                    abscissaCurve_m = curves_[curveId]->StartParameter_m() + abscissa_m;
-                }
-                else {
-                    abscissaCurve_m = curves_[curveId]->StartParameter_m() - abscissa_m;
-                }
-            }
-            abscissa_m = 0;
+            abscissaCurve_m = curve->StartParameter_m() - localAbscissa_m;
         }
     }
+    else if(curve->StartParameter_m() >= 0 and curve->EndParameter_m() <= 0) {
+        abscissaCurve_m = curve->StartParameter_m() - localAbscissa_m;
+    }
+    else if(curve->StartParameter_m() <= 0 and curve->EndParameter_m() >= 0) {
+        abscissaCurve_m = curve->StartParameter_m() + localAbscissa_m;
+    }
+    else {
+        if(curve->EndParameter_m() <= curve->StartParameter_m()) {
+            abscissaCurve_m = curve->StartParameter_m() + localAbscissa_m;
+        }
+        else {
+            abscissaCurve_m = curve->StartParameter_m() - localAbscissa_m;
+        }
+    }
+
     return std::make_tuple(abscissaCurve_m, curveId);
 }
 
 
 double Path::CurveAbsToPathAbs(double abscissaCurve_m, int curveId) {
 
-    double abscissa_m{0};
-
     if(curveId < 0 or curveId > (curvesNumber_ - 1)) 
         throw std::runtime_error(std::string("[Path::CurveAbsToPathAbs] CurveId out of bound!!"));
-    if(abscissaCurve_m > curves_[curveId]->Length())
+
+    if(std::abs(abscissaCurve_m - curves_[curveId]->StartParameter_m()) > curves_[curveId]->Length())
         throw std::runtime_error(std::string("[Path::CurveAbsToPathAbs] abscissaCurve_m is out of bound!!"));
 
-    abscissa_m += abscissaCurve_m;
-    
-    return abscissa_m;
+    return PathAbscissa(curveId, abscissaCurve_m);
 }
 
 
@@ -144,76 +233,112 @@ std::shared_ptr<std::vector<Eigen::Vector3d>> Path::Sampling(int samples) const
 
 void Path::Reverse() {
 
-    for(auto& elem: curves_)
-        elem->Reverse();
-    std::reverse(curves_.begin(), curves_.end());
+    // Each distinct curve object is reversed once, on a copy: the curves shared with other paths (Append, 
+    // CompositePath::Flatten, PathHorizon) or appearing more than once in this path are left untouched.
+    std::map<Curve const*, std::shared_ptr<Curve>> reversedCurves;
+    std::vector<std::shared_ptr<Curve>> curves;
+    curves.reserve(curves_.size());
+
+    for(auto it = curves_.rbegin(); it != curves_.rend(); ++it) {
+        auto& reversed = reversedCurves[it->get()];
+        if(reversed == nullptr) {
+            reversed = (*it)->Clone();
+            reversed->Reverse();
+        }
+        curves.push_back(reversed);
+    }
+
+    curves_ = std::move(curves);
+    segmentKernel_.reset();
+    lengthIndexValid_ = false;
 }
 
 
-Eigen::Vector3d Path::FindClosestPoint(Eigen::Vector3d& worldF_position, int& curveId, double& abscissa_m) {
+SegmentKernel const& Path::Kernel() {
 
-    Eigen::Vector3d closestPoint{Eigen::Vector3d::Zero()};
-    double distance{0};
+    if(segmentKernel_ == nullptr)
+        segmentKernel_ = std::make_shared<SegmentKernel>(curves_);
+
+    return *segmentKernel_;
+}
+
+
+std::tuple<int, double, double> Path::FindClosestCurve(Eigen::Vector3d& worldF_position, int firstCurve, int lastCurve) {
+
+    auto const& kernel = Kernel();
+
+    int curveId{-1};
+    double abscissa_m{0};
     double minDistance{std::numeric_limits<double>::max()};
+
+    // All the straight lines at once
+    int segmentId{-1};
+    double t{0};
+    double distance{0};
+    std::tie(segmentId, t, distance) = kernel.FindClosestSegment(worldF_position, kernel.FirstSegment(firstCurve), 
+        kernel.FirstSegment(lastCurve + 1));
+
+    if(segmentId >= 0) {
+        curveId = kernel.CurveId(segmentId);
+        abscissa_m = curves_[curveId]->StartParameter_m() + t * kernel.Length(segmentId);
+        minDistance = distance;
+    }
+
+    if(kernel.AllLines(firstCurve, lastCurve)) 
+        return std::make_tuple(curveId, abscissa_m, minDistance);
+
+    // The other curves one by one
     double abscissaTmp_m{0};
+    for(int i = firstCurve; i <= lastCurve; ++i) {
 
-    
-    for(std::size_t i = 0; i < curves_.size(); ++i) {
+        if(kernel.AllLines(i, i))
+            continue;
         
         try {
             std::tie(abscissaTmp_m, distance) = curves_[i]->FindClosestPoint(worldF_position);
         } catch(std::runtime_error const& exception) {
-            throw std::runtime_error(std::string{"[Path::FindClosestPoint] -> "} + exception.what());
+            throw std::runtime_error(std::string{"[Path::FindClosestCurve] -> "} + exception.what());
         }
 
-        if(distance > 0 and distance < minDistance) {
-            minDistance = distance;
-            curveId = i;
-            abscissa_m = abscissaTmp_m;
-        }
-        else if (distance == 0){
+        if(distance < minDistance or curveId < 0) {
             minDistance = distance;
             curveId = i;
             abscissa_m = abscissaTmp_m;
         }
     }
-    try {
-        curves_[curveId]->FromAbsMetersToPos(abscissa_m, closestPoint);
-    } catch(std::runtime_error const& exception) {
-        throw std::runtime_error(std::string("[Path::FindClosestPoint] -> ") + exception.what());
-    }
 
-    return closestPoint;
+    return std::make_tuple(curveId, abscissa_m, minDistance);
 }
 
-Eigen::Vector3d Path::FindClosestPoint(Eigen::Vector3d& worldF_position) {
+
+Eigen::Vector3d Path::FindClosestPoint(Eigen::Vector3d& worldF_position, int& curveId, double& abscissa_m) {
 
     Eigen::Vector3d closestPoint{Eigen::Vector3d::Zero()};
     double distance{0};
-    double minDistance{std::numeric_limits<double>::max()};
-    double abscissaTmp_m{0};
-    int curveId{0};
-    double abscissa_m{0};
 
-    for(std::size_t i = 0; i < curves_.size(); ++i) {
-       
-        try {
-            std::tie(abscissaTmp_m, distance) = curves_[i]->FindClosestPoint(worldF_position);
-        } catch(std::runtime_error const& exception) {
-            throw std::runtime_error(std::string{"[Path::FindClosestPoint] -> "} + exception.what());
-        }
+    if(curvesNumber_ == 0)
+        throw std::runtime_error("[Path::FindClosestPoint] The path is empty");
 
-        if(distance > 0 and distance < minDistance) {
-            minDistance = distance;
-            curveId = i;
-            abscissa_m = abscissaTmp_m;
-        }
-        else if (distance == 0){
-            minDistance = distance;
-            curveId = i;
-            abscissa_m = abscissaTmp_m;
-        }
+    try {
+        std::tie(curveId, abscissa_m, distance) = FindClosestCurve(worldF_position, 0, curvesNumber_ - 1);
+    } catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string{"[Path::FindClosestPoint] -> "} + exception.what());
+    }
+
+    // Only degenerate (null length) curves
+    if(curveId < 0) {
+        curveId = 0;
+        abscissa_m = curves_[0]->StartParameter_m();
+        return curves_[0]->StartPoint();
+    }
+
+    auto const& kernel = Kernel();
+    int segmentId{kernel.FirstSegment(curveId)};
+
+    if(kernel.AllLines(curveId, curveId) and segmentId < kernel.FirstSegment(curveId + 1)) {
+        return kernel.Point(segmentId, (abscissa_m - curves_[curveId]->StartParameter_m()) / kernel.Length(segmentId));
     }
+
     try {
         curves_[curveId]->FromAbsMetersToPos(abscissa_m, closestPoint);
     } catch(std::runtime_error const& exception) {
@@ -223,77 +348,134 @@ Eigen::Vector3d Path::FindClosestPoint(Eigen::Vector3d& worldF_position) {
     return closestPoint;
 }
 
+Eigen::Vector3d Path::FindClosestPoint(Eigen::Vector3d& worldF_position) {
+
+    int curveId{0};
+    double abscissa_m{0};
+
+    return FindClosestPoint(worldF_position, curveId, abscissa_m);
+}
+
 double Path::FindAbscissaClosestPoint(Eigen::Vector3d& worldF_position) {
 
-    double distance{0};
-    double minDistance{std::numeric_limits<double>::max()};
-    double abscissaTmp_m{0};
     int curveId{0};
     double abscissa_m{0};
+    double distance{0};
 
-    for(std::size_t i = 0; i < curves_.size(); ++i) {
-       
-        try {
-            std::tie(abscissaTmp_m, distance) = curves_[i]->FindClosestPoint(worldF_position);
-        } catch(std::runtime_error const& exception) {
-            throw std::runtime_error(std::string{"[Path::FindClosestPoint] -> "} + exception.what());
-        }
+    if(curvesNumber_ == 0)
+        throw std::runtime_error("[Path::FindAbscissaClosestPoint] The path is empty");
 
-        if(distance > 0 and distance < minDistance) {
-            minDistance = distance;
-            curveId = i;
-            abscissa_m = abscissaTmp_m;
-        }
-        else if (distance == 0){
-            minDistance = distance;
-            curveId = i;
-            abscissa_m = abscissaTmp_m;
-        }
+    try {
+        std::tie(curveId, abscissa_m, distance) = FindClosestCurve(worldF_position, 0, curvesNumber_ - 1);
+    } catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string{"[Path::FindAbscissaClosestPoint] -> "} + exception.what());
     }
 
-    for(int i = 0; i < curveId; ++i) {
-        abscissa_m += curves_[i]->Length();
-    }
-    // std::cout << "[Path::FindAbscissaClosestPoint] -> abscissa_m: " << abscissa_m << std::endl;
+    if(curveId < 0)
+        return startParameter_m_;
 
-    return abscissa_m;
+    return PathAbscissa(curveId, abscissa_m);
 }
 
 
 double Path::FindAbscissaClosestPointOnInterval(Eigen::Vector3d& worldF_position, double startValue, double endValue) {
 
-    double distance{0};
-    double minDistance{0};
-    double abscissaTmp_m{0};
     int curveId{0};
     double abscissa_m{0};
+    double distance{0};
 
-    auto section = ExtractSection(startValue, endValue);
+    try {
+        std::tie(curveId, abscissa_m, distance) = FindClosestCurveOnInterval(worldF_position, startValue, endValue);
+    } catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string{"[Path::FindAbscissaClosestPointOnInterval] -> "} + exception.what());
+    }
 
-    for(std::size_t i = 0; i < section->CurvesNumber(); ++i) {
-        try {
-            std::tie(abscissaTmp_m, distance) = section->Curves()[i]->FindClosestPoint(worldF_position);
-        } catch(std::runtime_error const& exception) {
-            throw std::runtime_error(std::string{"[Path::FindClosestPoint] -> "} + exception.what());
+    // Only degenerate (null length) curves
+    if(curveId < 0)
+        return std::min(startValue, endValue);
+
+    return PathAbscissa(curveId, abscissa_m);
+}
+
+
+std::tuple<int, double, double> Path::FindClosestCurveOnInterval(Eigen::Vector3d& worldF_position, double startValue_m, 
+    double endValue_m) {
+
+    if(startValue_m > endValue_m)
+        std::swap(startValue_m, endValue_m);
+
+    double startCurve_m{0};
+    double endCurve_m{0};
+    int startCurveId{0};
+    int endCurveId{0};
+
+    std::tie(startCurve_m, startCurveId) = PathAbsToCurveAbs(startValue_m);
+    std::tie(endCurve_m, endCurveId) = PathAbsToCurveAbs(endValue_m);
+
+    auto const& kernel = Kernel();
+
+    int curveId{-1};
+    double abscissa_m{0};
+    double minDistance{std::numeric_limits<double>::max()};
+    double abscissaTmp_m{0};
+    double distance{0};
+
+    // Portion of a single curve: the segment of a straight line through the kernel, the other curves on their own
+    auto searchPortion = [&](int id, double fromValue_m, double toValue_m) {
+        auto const& curve = curves_[id];
+        int segmentId{kernel.FirstSegment(id)};
+
+        if(segmentId < kernel.FirstSegment(id + 1)) {
+            double t{0};
+            double tFrom{(fromValue_m - curve->StartParameter_m()) / curve->Length()};
+            double tTo{(toValue_m - curve->StartParameter_m()) / curve->Length()};
+            std::tie(t, distance) = kernel.Project(segmentId, worldF_position, std::min(tFrom, tTo), std::max(tFrom, tTo));
+            abscissaTmp_m = curve->StartParameter_m() + t * kernel.Length(segmentId);
+        }
+        else if(kernel.AllLines(id, id)) {
+            return; // Null length line
+        }
+        else {
+            std::tie(abscissaTmp_m, distance) = curve->FindClosestPointOnInterval(worldF_position, fromValue_m, toValue_m);
         }
 
-        if(minDistance > 0 and distance < minDistance) {
+        if(distance < minDistance or curveId < 0) {
             minDistance = distance;
-            curveId = i;
+            curveId = id;
             abscissa_m = abscissaTmp_m;
         }
-        else if (minDistance == 0){
+    };
+
+    if(startCurveId == endCurveId) {
+        searchPortion(startCurveId, startCurve_m, endCurve_m);
+        return std::make_tuple(curveId, abscissa_m, minDistance);
+    }
+
+    searchPortion(startCurveId, startCurve_m, curves_[startCurveId]->EndParameter_m());
+    searchPortion(endCurveId, curves_[endCurveId]->StartParameter_m(), endCurve_m);
+
+    // The whole curves in between
+    if(endCurveId - startCurveId > 1) {
+        int innerCurveId{-1};
+        std::tie(innerCurveId, abscissaTmp_m, distance) = FindClosestCurve(worldF_position, startCurveId + 1, endCurveId - 1);
+        if(innerCurveId >= 0 and (distance < minDistance or curveId < 0)) {
             minDistance = distance;
-            curveId = i;
+            curveId = innerCurveId;
             abscissa_m = abscissaTmp_m;
         }
     }
 
-    for(int i = 0; i < curveId; ++i) {
-        abscissa_m += section->Curves()[i]->Length();
-    }
+    return std::make_tuple(curveId, abscissa_m, minDistance);
+}
+
+
+double Path::PathAbscissa(int curveId, double abscissaCurve_m) {
+
+    auto const& curve = curves_[curveId];
 
-    return abscissa_m + startValue;
+    // Clamped on the path end: the prefix sums and the total length are rounded on different partial sums.
+    return std::min(startParameter_m_ + Lengths().Prefix(curveId) 
+        + std::min(std::abs(abscissaCurve_m - curve->StartParameter_m()), curve->Length()), endParameter_m_);
 }
 
 
@@ -378,9 +560,7 @@ std::vector<Eigen::Vector3d> Path::Intersection(std::shared_ptr<Path> otherPath)
             }
             
             for (auto const & point: intersectionPoints) {
-                if (std::count(intersections.begin(), intersections.end(), point) == 0) {
-                    intersections.push_back(point);
-                }
+                Geometry::AddUniquePoint(intersections, point, Curve::MergeDistance());
             }
         }
     }
@@ -404,9 +584,7 @@ std::vector<Eigen::Vector3d> Path::Intersection(std::shared_ptr<Curve> otherCurv
         }
 
         for (auto const & point: intersectionPoints) {
-            if (std::count(intersections.begin(), intersections.end(), point) == 0) {
-                intersections.push_back(point);
-            }
+            Geometry::AddUniquePoint(intersections, point, Curve::MergeDistance());
         }
     }
     
@@ -434,9 +612,7 @@ std::vector<Eigen::Vector3d> Path::Intersection(int curveId, std::shared_ptr<Pat
         }
 
         for (auto const & point: intersectionPoints) {
-            if (std::count(intersections.begin(), intersections.end(), point) == 0) {
-                intersections.push_back(point);
-            }
+            Geometry::AddUniquePoint(intersections, point, Curve::MergeDistance());
         }
     }
     
@@ -461,9 +637,7 @@ std::vector<Eigen::Vector3d> Path::Intersection(int curveId, std::shared_ptr<Cur
     }
 
     for (auto const & point: intersectionPoints) {
-        if (std::count(intersections.begin(), intersections.end(), point) == 0) {
-            intersections.push_back(point);
-        }
+        Geometry::AddUniquePoint(intersections, point, Curve::MergeDistance());
     }
 
     return intersections;
@@ -484,3 +658,372 @@ void Path::EvalTangentFrame(double abscissa_m, Eigen::Vector3d& tangent, Eigen::
 
     curves_[curveId]->EvalTangentFrame(abscissaCurve, tangent, normal, binormal);
 }
+
+
+
+std::vector<std::shared_ptr<Curve>> Path::RegularOffsetSections(std::shared_ptr<Curve> const& curve, double distance) {
+
+    std::vector<std::shared_ptr<Curve>> sections;
+
+    if(std::dynamic_pointer_cast<StraightLine>(curve) or std::dynamic_pointer_cast<CircularArc>(curve) 
+        or std::dynamic_pointer_cast<Clothoid>(curve)) {
+        sections.push_back(curve);
+        return sections;
+    }
+
+    // Sample the signed curvature (planar curve) and keep the runs where the offset speed is positive.
+    const int samples{64};
+    const double minSpeed{1e-3};
+    const double step{curve->Length() / (samples - 1)};
+    int runStart{-1};
+    bool regular{true};
+
+    for(int i = 0; i <= samples; ++i) {
+
+        bool valid{false};
+        if(i < samples) {
+            double abscissa_m{std::min(curve->StartParameter_m() + i * step, curve->EndParameter_m())};
+            auto derivatives = curve->Derivate(2, abscissa_m);
+            double speed{derivatives[0].head<2>().norm()};
+            double signedCurvature{speed > 0 ? (derivatives[0][0] * derivatives[1][1] - derivatives[0][1] * derivatives[1][0]) 
+                / std::pow(speed, 3) : 0};
+            valid = (1 - distance * signedCurvature) > minSpeed;
+            regular = regular and valid;
+        }
+
+        if(valid and runStart < 0) {
+            runStart = i;
+        }
+        else if(not valid and runStart >= 0) {
+            if(i - 1 > runStart and not regular) {
+                sections.push_back(curve->ExtractSection(curve->StartParameter_m() + runStart * step, 
+                    std::min(curve->StartParameter_m() + (i - 1) * step, curve->EndParameter_m())));
+            }
+            runStart = -1;
+        }
+    }
+
+    if(regular)
+        sections.push_back(curve);
+
+    return sections;
+}
+
+
+std::shared_ptr<Curve> Path::JoinOffsetCurves(std::shared_ptr<Curve>& previous, std::shared_ptr<Curve>& next, 
+    Eigen::Vector3d const& vertex, double distance, double tolerance) {
+
+    if((previous->EndPoint() - next->StartPoint()).norm() <= tolerance)
+        return nullptr;
+
+    auto intersections = previous->Intersection(next);
+
+    if(not intersections.empty()) {
+
+        // Concave side: trim both curves at the intersection closest to the original vertex.
+        auto closest = std::min_element(intersections.begin(), intersections.end(), 
+            [&vertex](Eigen::Vector3d const& a, Eigen::Vector3d const& b) { return (a - vertex).norm() < (b - vertex).norm(); });
+
+        double previousAbscissa{0};
+        double nextAbscissa{0};
+        std::tie(previousAbscissa, std::ignore) = previous->FindClosestPoint(*closest);
+        std::tie(nextAbscissa, std::ignore) = next->FindClosestPoint(*closest);
+
+        if(previousAbscissa - previous->StartParameter_m() <= tolerance)
+            previous = nullptr;
+        else if(previous->EndParameter_m() - previousAbscissa > tolerance)
+            previous = previous->ExtractSection(previous->StartParameter_m(), previousAbscissa);
+
+        if(next->EndParameter_m() - nextAbscissa <= tolerance)
+            next = nullptr;
+        else if(nextAbscissa - next->StartParameter_m() > tolerance)
+            next = next->ExtractSection(nextAbscissa, next->EndParameter_m());
+
+        return nullptr;
+    }
+
+    // Convex side: round join around the original vertex when both end points lie on the offset circle.
+    Eigen::Vector3d fromVertex{previous->EndPoint() - vertex};
+    Eigen::Vector3d toVertex{next->StartPoint() - vertex};
+    const double radiusTolerance{10 * tolerance};
+
+    if(std::abs(fromVertex.norm() - std::abs(distance)) <= radiusTolerance 
+        and std::abs(toVertex.norm() - std::abs(distance)) <= radiusTolerance) {
+
+        double angle{std::atan2(fromVertex.cross(toVertex)[2], fromVertex.dot(toVertex))};
+        return std::make_shared<CircularArc>(angle, Eigen::Vector3d::UnitZ(), previous->EndPoint(), vertex);
+    }
+
+    return std::make_shared<StraightLine>(previous->EndPoint(), next->StartPoint());
+}
+
+
+std::shared_ptr<Path> Path::Offset(double distance, double tolerance) {
+
+    auto offsetPath = std::make_shared<Path>();
+
+    if(curvesNumber_ == 0)
+        return offsetPath;
+
+    // Offset every regular section, keeping the original start point of each piece as vertex for the junctions.
+    std::vector<std::shared_ptr<Curve>> offsetCurves;
+    std::vector<Eigen::Vector3d> vertices;
+
+    try {
+        for(auto const& curve: curves_) {
+            if(curve->Length() == 0)
+                continue;
+
+            for(auto const& section: RegularOffsetSections(curve, distance)) {
+                auto offsetCurve = section->Offset(distance, tolerance);
+                if(offsetCurve != nullptr) {
+                    offsetCurves.push_back(offsetCurve);
+                    vertices.push_back(section->StartPoint());
+                }
+            }
+        }
+    } catch (std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[Path::Offset] -> ") + exception.what());
+    }
+
+    if(offsetCurves.empty())
+        return offsetPath;
+
+    std::vector<std::shared_ptr<Curve>> joined{offsetCurves.front()};
+
+    try {
+        for(std::size_t i = 1; i < offsetCurves.size(); ++i) {
+
+            auto next = offsetCurves[i];
+            std::shared_ptr<Curve> connection;
+
+            while(not joined.empty() and next != nullptr) {
+                connection = JoinOffsetCurves(joined.back(), next, vertices[i], distance, tolerance);
+                if(joined.back() != nullptr)
+                    break;
+                // The previous curve has been trimmed away: join with the one before it.
+                joined.pop_back();
+            }
+
+            if(connection != nullptr)
+                joined.push_back(connection);
+            if(next != nullptr)
+                joined.push_back(next);
+        }
+
+        bool closed{(curves_.front()->StartPoint() - curves_.back()->EndPoint()).norm() <= tolerance and joined.size() > 1};
+        if(closed) {
+            auto connection = JoinOffsetCurves(joined.back(), joined.front(), curves_.front()->StartPoint(), distance, tolerance);
+            if(connection != nullptr)
+                joined.push_back(connection);
+        }
+    } catch (std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[Path::Offset] -> ") + exception.what());
+    }
+
+    joined.erase(std::remove(joined.begin(), joined.end(), nullptr), joined.end());
+
+    // The junctions only trim the loops among consecutive curves: a crossing among the other curves (e.g. an inward offset 
+    // wider than a narrow part of the path) is a global self-intersection. The points within tolerance of an end point 
+    // of both curves are junctions around a short connection.
+    const std::size_t joinedNumber{joined.size()};
+    const bool closed{joinedNumber > 1 and (joined.front()->StartPoint() - joined.back()->EndPoint()).norm() <= tolerance};
+
+    auto nearEnds = [tolerance](Eigen::Vector3d const& point, Curve const& curve) {
+        return (point - curve.StartPoint()).norm() <= tolerance or (point - curve.EndPoint()).norm() <= tolerance;
+    };
+
+    for(std::size_t i = 0; i + 2 < joinedNumber; ++i) {
+        for(std::size_t j = i + 2; j < joinedNumber; ++j) {
+            if(closed and i == 0 and j == joinedNumber - 1)
+                continue;
+
+            std::vector<Eigen::Vector3d> intersections;
+            try {
+                intersections = joined[i]->Intersection(joined[j]);
+            } catch (std::runtime_error const& exception) {
+                throw std::runtime_error(std::string("[Path::Offset] -> ") + exception.what());
+            }
+
+            for(auto const& point: intersections) {
+                if(not nearEnds(point, *joined[i]) or not nearEnds(point, *joined[j]))
+                    throw std::runtime_error("[Path::Offset] The offset path intersects itself between the curves " 
+                        + std::to_string(i) + " and " + std::to_string(j));
+            }
+        }
+    }
+
+    for(auto const& curve: joined)
+        offsetPath->AddCurveBack<Curve>(curve);
+
+    offsetPath->name_ = name_ + " offset";
+
+    return offsetPath;
+}
+
+
+std::vector<std::shared_ptr<Path>> Path::Offset(std::vector<double> const& distances, double tolerance) {
+
+    std::vector<std::shared_ptr<Path>> offsetPaths;
+    offsetPaths.reserve(distances.size());
+
+    for(auto distance: distances) {
+        try {
+            offsetPaths.push_back(Offset(distance, tolerance));
+        } catch (std::runtime_error const& exception) {
+            throw std::runtime_error(std::string("[Path::Offset] -> ") + exception.what());
+        }
+    }
+
+    return offsetPaths;
+}
+
+
+std::shared_ptr<Path> Path::Simplify(double tolerance, bool joinCurves) {
+
+    std::vector<std::shared_ptr<Curve>> merged;
+    merged.reserve(curves_.size());
+
+    // Run of mergeable curves, built only once when the run ends.
+    std::shared_ptr<Curve> runFirst;
+    std::shared_ptr<StraightLine> runLine;
+    std::shared_ptr<CircularArc> runArc;
+    int runCount{0};
+    Eigen::Vector3d runStart{};
+    Eigen::Vector3d runEnd{};
+    // Inner vertices of a run of straight lines, in the frame [u, e1, e2] of its first line (O(1) per line instead of
+    // keeping the vertices): range of their abscissae along u and, per lateral axis, the interval of the chord slopes
+    // that keep all of them within tolerance / sqrt(2) on that axis.
+    Eigen::Matrix3d runFrame{};
+    double runMinAlong{0};
+    double runMaxAlong{0};
+    Eigen::Vector2d runMinSlope{};
+    Eigen::Vector2d runMaxSlope{};
+    bool runHasVertices{false};
+    double runAngle{0};
+
+    auto flushRun = [&]() {
+        if(runCount == 1)
+            merged.push_back(runFirst);
+        else if(runCount > 1 and runLine)
+            merged.push_back(std::make_shared<StraightLine>(runStart, runEnd));
+        else if(runCount > 1 and runArc)
+            merged.push_back(std::make_shared<CircularArc>(runAngle, runArc->Axis(), runStart, runArc->CentrePoint()));
+        runFirst = nullptr;
+        runLine = nullptr;
+        runArc = nullptr;
+        runCount = 0;
+        runHasVertices = false;
+    };
+
+    auto distanceFromSegment = [](Eigen::Vector3d const& point, Eigen::Vector3d const& start, Eigen::Vector3d const& end) {
+        Eigen::Vector3d segment{end - start};
+        double ratio{std::max(0.0, std::min(1.0, (point - start).dot(segment) / segment.squaredNorm()))};
+        return (start + ratio * segment - point).norm();
+    };
+
+    try {
+        for(auto const& curve: curves_) {
+
+            if(curve->Length() == 0)
+                continue;
+
+            auto line = std::dynamic_pointer_cast<StraightLine>(curve);
+            auto arc = std::dynamic_pointer_cast<CircularArc>(curve);
+            bool continuous{runCount > 0 and (runEnd - curve->StartPoint()).norm() <= tolerance};
+
+            if(continuous and runLine and line) {
+                // Collinear if every vertex of the run stays within tolerance from the new chord. The last vertex is
+                // checked exactly, the previous ones through the slope intervals: a vertex is within tolerance from the
+                // chord point with its same abscissa along u, which is on the segment if the abscissa is in the chord.
+                Eigen::Vector3d chord{line->EndPoint() - runStart};
+                const Eigen::Vector3d chordFrame{runFrame.transpose() * chord};
+                bool collinear{chord.norm() > tolerance and chord.dot(line->EndPoint() - line->StartPoint()) > 0 
+                    and distanceFromSegment(runEnd, runStart, line->EndPoint()) <= tolerance};
+                if(collinear and runHasVertices) {
+                    const Eigen::Vector2d slope{chordFrame.tail<2>() / chordFrame[0]};
+                    collinear = runMinAlong > 0 and runMaxAlong <= chordFrame[0] 
+                        and (slope.array() >= runMinSlope.array()).all() and (slope.array() <= runMaxSlope.array()).all();
+                }
+
+                if(collinear) {
+                    const Eigen::Vector3d vertex{runFrame.transpose() * (runEnd - runStart)};
+                    const double along{std::max(vertex[0], std::numeric_limits<double>::min())};
+                    const Eigen::Vector2d minSlope{(vertex.tail<2>().array() - tolerance / std::sqrt(2.0)) / along};
+                    const Eigen::Vector2d maxSlope{(vertex.tail<2>().array() + tolerance / std::sqrt(2.0)) / along};
+                    runMinAlong = runHasVertices ? std::min(runMinAlong, vertex[0]) : vertex[0];
+                    runMaxAlong = runHasVertices ? std::max(runMaxAlong, vertex[0]) : vertex[0];
+                    runMinSlope = runHasVertices ? Eigen::Vector2d{runMinSlope.cwiseMax(minSlope)} : minSlope;
+                    runMaxSlope = runHasVertices ? Eigen::Vector2d{runMaxSlope.cwiseMin(maxSlope)} : maxSlope;
+                    runHasVertices = true;
+                    runEnd = line->EndPoint();
+                    ++runCount;
+                    continue;
+                }
+            }
+            else if(continuous and runArc and arc) {
+                // Co-circular with the same turning direction.
+                Eigen::Vector3d runTurn{runArc->Axis().normalized() * (runAngle > 0 ? 1 : -1)};
+                Eigen::Vector3d turn{arc->Axis().normalized() * (arc->Angle() > 0 ? 1 : -1)};
+                double runRadius{(runStart - runArc->CentrePoint()).norm()};
+                double radius{(arc->StartPoint() - arc->CentrePoint()).norm()};
+                double angle{runAngle + (runAngle > 0 ? 1 : -1) * std::abs(arc->Angle())};
+
+                if((runArc->CentrePoint() - arc->CentrePoint()).norm() <= tolerance and std::abs(runRadius - radius) <= tolerance
+                    and runTurn.dot(turn) > 1 - 1e-9 and std::abs(angle) < 2 * M_PI) {
+                    runAngle = angle;
+                    runEnd = arc->EndPoint();
+                    ++runCount;
+                    continue;
+                }
+            }
+
+            flushRun();
+
+            runFirst = curve;
+            runLine = line;
+            runArc = arc;
+            runCount = 1;
+            runStart = curve->StartPoint();
+            runEnd = curve->EndPoint();
+            runAngle = arc ? arc->Angle() : 0;
+            if(line) {
+                const Eigen::Vector3d direction{(runEnd - runStart).normalized()};
+                const Eigen::Vector3d reference{std::abs(direction[2]) < 0.9 ? Eigen::Vector3d::UnitZ() : Eigen::Vector3d::UnitX()};
+                runFrame.col(0) = direction;
+                runFrame.col(1) = direction.cross(reference).normalized();
+                runFrame.col(2) = direction.cross(runFrame.col(1));
+            }
+        }
+        flushRun();
+    } catch (std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[Path::Simplify] -> ") + exception.what());
+    }
+
+    auto simplifiedPath = std::make_shared<Path>();
+    simplifiedPath->name_ = name_;
+
+    if(merged.empty())
+        return simplifiedPath;
+
+    if(not joinCurves) {
+        for(auto const& curve: merged)
+            simplifiedPath->AddCurveBack<Curve>(curve);
+        return simplifiedPath;
+    }
+
+    auto current = merged.front();
+    for(std::size_t i = 1; i < merged.size(); ++i) {
+        auto joined = current->Join(merged[i], tolerance);
+        if(joined) {
+            current = joined;
+        }
+        else {
+            simplifiedPath->AddCurveBack<Curve>(current);
+            current = merged[i];
+        }
+    }
+    simplifiedPath->AddCurveBack<Curve>(current);
+
+    return simplifiedPath;
+}
@@ -5,6 +5,13 @@
 #include "sisl_toolbox/straight_line.hpp"
 #include "sisl_toolbox/circular_arc.hpp"
 #include "sisl_toolbox/generic_curve.hpp"
+#include "sisl_toolbox/clothoid.hpp"
+#include "sisl_toolbox/geodetic_frame.hpp"
+#include "sisl_toolbox/planar_path.hpp"
+#include "sisl_toolbox/geometry.hpp"
+
+#include <cmath>
+#include <limits>
 
 
 std::shared_ptr<Path> PathFactory::NewPolygonalChain(std::vector<Eigen::Vector3d> points) {
@@ -52,6 +59,49 @@ std::shared_ptr<Path> PathFactory::NewPolygon(std::vector<Eigen::Vector3d> point
     }
 
 
+std::shared_ptr<Path> PathFactory::NewRoundedPolygonalChain(std::vector<Eigen::Vector3d> points, double radius, 
+    double transitionLength) {
+
+        if(points.size() < 2)
+            throw std::runtime_error("[PathFactory::NewRoundedPolygonalChain] Wrong number of points! Received a vector of size " 
+                + std::to_string(points.size()) + ", while expecting one of at least size 2.");
+        if(radius <= 0)
+            throw std::runtime_error("[PathFactory::NewRoundedPolygonalChain] Input parameter error. radius must be positive");
+
+        std::shared_ptr<Path> polygonalChain;
+        try {
+            polygonalChain = RoundCorners(points, radius, transitionLength, false);
+        } catch (std::runtime_error const& exception) {
+            throw std::runtime_error(std::string("[PathFactory::NewRoundedPolygonalChain] -> ") + exception.what());
+        }
+
+        polygonalChain->name_ = "Rounded Polygonal Chain";
+
+        return polygonalChain;
+    }
+
+
+std::shared_ptr<Path> PathFactory::NewRoundedPolygon(std::vector<Eigen::Vector3d> points, double radius, double transitionLength) {
+
+        if(points.size() < 3)
+            throw std::runtime_error("[PathFactory::NewRoundedPolygon] Wrong number of points! Received a vector of size " 
+                + std::to_string(points.size()) + ", while expecting one of at least size 3.");
+        if(radius <= 0)
+            throw std::runtime_error("[PathFactory::NewRoundedPolygon] Input parameter error. radius must be positive");
+
+        std::shared_ptr<Path> polygon;
+        try {
+            polygon = RoundCorners(points, radius, transitionLength, true);
+        } catch (std::runtime_error const& exception) {
+            throw std::runtime_error(std::string("[PathFactory::NewRoundedPolygon] -> ") + exception.what());
+        }
+
+        polygon->name_ = "Rounded Polygon";
+
+        return polygon;
+    }
+
+
 std::shared_ptr<Path> PathFactory::NewHippodrome(std::vector<Eigen::Vector3d> points) {
 
         auto hippodrome = std::make_shared<Path>();
@@ -100,7 +150,7 @@ std::shared_ptr<Path> PathFactory::NewSpiral(Eigen::Vector3d centrePoint, Eigen:
         spiral->name_ = "Spiral";
 
         double const angle{3.14};
-        double radius {Distance(centrePoint, startPoint)};
+        double radius {Geometry::Distance(centrePoint, startPoint)};
         auto axis = Eigen::Vector3d{0, 0, 1};
 
         auto directionCentreToStartPoint = Eigen::Vector3d(centrePoint[0] - startPoint[0], centrePoint[1] - startPoint[1], centrePoint[2] - startPoint[2]);
@@ -123,7 +173,7 @@ std::shared_ptr<Path> PathFactory::NewSpiral(Eigen::Vector3d centrePoint, Eigen:
 
 
 std::shared_ptr<Path> PathFactory::NewRaceTrack(double angle, int direction, double firstRadius, double secondRadius, 
-    std::vector<Eigen::Vector3d>& polygonVerteces) {
+    std::vector<Eigen::Vector3d>& polygonVerteces, double transitionLength) {
 
     if(firstRadius < secondRadius) std::swap(firstRadius, secondRadius);
 
@@ -135,7 +185,7 @@ std::shared_ptr<Path> PathFactory::NewRaceTrack(double angle, int direction, dou
 
     // Compute the rectangle surrounding the polygon
     double maxX{}; double minX{}; double maxY{}; double minY{};
-    std::tie(maxX, minX, maxY, minY) = evalRectangleBoundingBox(polygonVerteces);
+    std::tie(maxX, minX, maxY, minY) = Geometry::BoundingBox(polygonVerteces);
 
     const Eigen::Vector3d rectangleCentre {(maxX + minX) / 2, (maxY + minY) / 2, 0};
     std::vector<Eigen::Vector3d> rectangleVertices{Eigen::Vector3d{maxX, maxY, 0}, Eigen::Vector3d{maxX, minY, 0},
@@ -143,23 +193,26 @@ std::shared_ptr<Path> PathFactory::NewRaceTrack(double angle, int direction, dou
     auto rectangle = PathFactory::NewPolygon(rectangleVertices);
 
     // Transform the angle in the interval [0, 360)
-    angle = ConvertToAngleInterval(angle);
+    angle = Geometry::ConvertToAngleInterval(angle);
     const double rectangleBase = {(std::abs(maxY) + std::abs(minY)) / 2}; // Eval lenght of the rectangle base
     const double rectangleHeight = {(std::abs(maxX) + std::abs(minX)) / 2}; // Eval lenght of the rectangle height
-    const double rectangleDiagonal{std::sqrt(std::pow(maxX - minX, 2) + std::pow(maxY - minY, 2))}; // Eval lenght of the rectangle diagonal
+    const double rectangleDiagonal{Geometry::Distance(rectangleVertices[0], rectangleVertices[2])}; // Eval lenght of the rectangle diagonal
 
     // Angle in radians
-    const double angleRadians {angle * M_PI / 180.0};
+    const double angleRadians {Geometry::DegToRad(angle)};
+    // Direction of the sweep lines and their normal, the loops below only scale and shift them
+    const Eigen::Vector3d lineDirection {std::cos(angleRadians), std::sin(angleRadians), 0};
+    const Eigen::Vector3d lineNormal {-lineDirection[1], lineDirection[0], 0};
 
 
     /** NOTE: Computation of the Starting Point of the Serpentine */
     
     auto polygonIntersRectangle = polygon->Intersection(rectangle);
     auto firstLine = std::make_shared<StraightLine>(
-        Eigen::Vector3d{rectangleCentre[0] - 2 * rectangleDiagonal * std::cos(angleRadians), 
-                        rectangleCentre[1] - 2 * rectangleDiagonal * std::sin(angleRadians), 0}, 
-        Eigen::Vector3d{rectangleCentre[0] + 2 * rectangleDiagonal * std::cos(angleRadians), 
-                        rectangleCentre[1] + 2 * rectangleDiagonal * std::sin(angleRadians), 0});
+        Eigen::Vector3d{rectangleCentre[0] - 2 * rectangleDiagonal * lineDirection[0], 
+                        rectangleCentre[1] - 2 * rectangleDiagonal * lineDirection[1], 0}, 
+        Eigen::Vector3d{rectangleCentre[0] + 2 * rectangleDiagonal * lineDirection[0], 
+                        rectangleCentre[1] + 2 * rectangleDiagonal * lineDirection[1], 0});
     auto nextLine = firstLine;
 
     double shiftingValue{2};
@@ -172,17 +225,17 @@ std::shared_ptr<Path> PathFactory::NewRaceTrack(double angle, int direction, dou
 
         if(direction == RIGHT) {
             nextLine = std::make_shared<StraightLine>(
-                Eigen::Vector3d{rectangleCentre[0] - 2 * rectangleDiagonal * std::cos(angleRadians) - counter * shiftingValue * std::cos(angleRadians + M_PI/2), 
-                                rectangleCentre[1] - 2 * rectangleDiagonal * std::sin(angleRadians) - counter * shiftingValue * std::sin(angleRadians + M_PI/2), 0}, 
-                Eigen::Vector3d{rectangleCentre[0] + 2 * rectangleDiagonal * std::cos(angleRadians) - counter * shiftingValue * std::cos(angleRadians + M_PI/2), 
-                                rectangleCentre[1] + 2 * rectangleDiagonal * std::sin(angleRadians) - counter * shiftingValue * std::sin(angleRadians + M_PI/2), 0});
+                Eigen::Vector3d{rectangleCentre[0] - 2 * rectangleDiagonal * lineDirection[0] - counter * shiftingValue * lineNormal[0], 
+                                rectangleCentre[1] - 2 * rectangleDiagonal * lineDirection[1] - counter * shiftingValue * lineNormal[1], 0}, 
+                Eigen::Vector3d{rectangleCentre[0] + 2 * rectangleDiagonal * lineDirection[0] - counter * shiftingValue * lineNormal[0], 
+                                rectangleCentre[1] + 2 * rectangleDiagonal * lineDirection[1] - counter * shiftingValue * lineNormal[1], 0});
         }
         else {
             nextLine = std::make_shared<StraightLine>(
-                Eigen::Vector3d{rectangleCentre[0] - 2 * rectangleDiagonal * std::cos(angleRadians) + counter * shiftingValue * std::cos(angleRadians + M_PI/2), 
-                                rectangleCentre[1] - 2 * rectangleDiagonal * std::sin(angleRadians) + counter * shiftingValue * std::sin(angleRadians + M_PI/2), 0}, 
-                Eigen::Vector3d{rectangleCentre[0] + 2 * rectangleDiagonal * std::cos(angleRadians) + counter * shiftingValue * std::cos(angleRadians + M_PI/2), 
-                                rectangleCentre[1] + 2 * rectangleDiagonal * std::sin(angleRadians) + counter * shiftingValue * std::sin(angleRadians + M_PI/2), 0});
+                Eigen::Vector3d{rectangleCentre[0] - 2 * rectangleDiagonal * lineDirection[0] + counter * shiftingValue * lineNormal[0], 
+                                rectangleCentre[1] - 2 * rectangleDiagonal * lineDirection[1] + counter * shiftingValue * lineNormal[1], 0}, 
+                Eigen::Vector3d{rectangleCentre[0] + 2 * rectangleDiagonal * lineDirection[0] + counter * shiftingValue * lineNormal[0], 
+                                rectangleCentre[1] + 2 * rectangleDiagonal * lineDirection[1] + counter * shiftingValue * lineNormal[1], 0});
         }
         ++counter;
     }
@@ -208,11 +261,10 @@ std::shared_ptr<Path> PathFactory::NewRaceTrack(double angle, int direction, dou
             intersectionPoints.push_back(intersecTmp[0]);
         } 
         else {
-            double angleDirection = std::atan2(intersecTmp[1][1] - intersecTmp[0][1], intersecTmp[1][0] - intersecTmp[0][0]);
-            if(angleDirection < 0) angleDirection += 2*M_PI;
-            angleDirection = std::round(RadToDeg(angleDirection));
+            // Order of the intersections w.r.t. the direction of the sweep lines (no rounded angle comparison).
+            const bool alongSweep {(intersecTmp[1] - intersecTmp[0]).dot(lineDirection) > 0};
 
-            if(angleDirection == angle) {
+            if(alongSweep) {
                 if(changeDirection) {
                     intersectionPoints.push_back(intersecTmp[1]);
                     intersectionPoints.push_back(intersecTmp[0]);
@@ -239,20 +291,20 @@ std::shared_ptr<Path> PathFactory::NewRaceTrack(double angle, int direction, dou
             double counter = 1;
             if(changeRadius) {
 
-                startPointSegment[0] = startPointSegment[0] - counter * secondRadius * std::cos(angleRadians + M_PI/2);
-                startPointSegment[1] = startPointSegment[1] - counter * secondRadius * std::sin(angleRadians + M_PI/2);
-                endPointSegment[0] = endPointSegment[0] - counter * secondRadius * std::cos(angleRadians + M_PI/2);
-                endPointSegment[1] = endPointSegment[1] - counter * secondRadius * std::sin(angleRadians + M_PI/2);
+                startPointSegment[0] = startPointSegment[0] - counter * secondRadius * lineNormal[0];
+                startPointSegment[1] = startPointSegment[1] - counter * secondRadius * lineNormal[1];
+                endPointSegment[0] = endPointSegment[0] - counter * secondRadius * lineNormal[0];
+                endPointSegment[1] = endPointSegment[1] - counter * secondRadius * lineNormal[1];
 
                 nextLine = std::make_shared<StraightLine>(
                     Eigen::Vector3d{startPointSegment[0], startPointSegment[1], 0}, 
                     Eigen::Vector3d{endPointSegment[0], endPointSegment[1], 0});
             }
             else {
-                startPointSegment[0] = startPointSegment[0] + counter * firstRadius * std::cos(angleRadians + M_PI/2);
-                startPointSegment[1] = startPointSegment[1] + counter * firstRadius * std::sin(angleRadians + M_PI/2);
-                endPointSegment[0] = endPointSegment[0] + counter * firstRadius * std::cos(angleRadians + M_PI/2);
-                endPointSegment[1] = endPointSegment[1] + counter * firstRadius * std::sin(angleRadians + M_PI/2);
+                startPointSegment[0] = startPointSegment[0] + counter * firstRadius * lineNormal[0];
+                startPointSegment[1] = startPointSegment[1] + counter * firstRadius * lineNormal[1];
+                endPointSegment[0] = endPointSegment[0] + counter * firstRadius * lineNormal[0];
+                endPointSegment[1] = endPointSegment[1] + counter * firstRadius * lineNormal[1];
 
                 nextLine = std::make_shared<StraightLine>(
                     Eigen::Vector3d{startPointSegment[0], startPointSegment[1], 0}, 
@@ -264,10 +316,10 @@ std::shared_ptr<Path> PathFactory::NewRaceTrack(double angle, int direction, dou
             if(changeRadius) {
                 // std::cout << "Using secondRadius..." << std::endl;
 
-                startPointSegment[0] = startPointSegment[0] + counter * secondRadius * std::cos(angleRadians + M_PI/2);
-                startPointSegment[1] = startPointSegment[1] + counter * secondRadius * std::sin(angleRadians + M_PI/2);
-                endPointSegment[0] = endPointSegment[0] + counter * secondRadius * std::cos(angleRadians + M_PI/2);
-                endPointSegment[1] = endPointSegment[1] + counter * secondRadius * std::sin(angleRadians + M_PI/2);
+                startPointSegment[0] = startPointSegment[0] + counter * secondRadius * lineNormal[0];
+                startPointSegment[1] = startPointSegment[1] + counter * secondRadius * lineNormal[1];
+                endPointSegment[0] = endPointSegment[0] + counter * secondRadius * lineNormal[0];
+                endPointSegment[1] = endPointSegment[1] + counter * secondRadius * lineNormal[1];
 
                 nextLine = std::make_shared<StraightLine>(
                     Eigen::Vector3d{startPointSegment[0], startPointSegment[1], 0}, 
@@ -276,10 +328,10 @@ std::shared_ptr<Path> PathFactory::NewRaceTrack(double angle, int direction, dou
             else {
                 // std::cout << "Using firstRadius..." << std::endl;
 
-                startPointSegment[0] = startPointSegment[0] - counter * firstRadius * std::cos(angleRadians + M_PI/2);
-                startPointSegment[1] = startPointSegment[1] - counter * firstRadius * std::sin(angleRadians + M_PI/2);
-                endPointSegment[0] = endPointSegment[0] - counter * firstRadius * std::cos(angleRadians + M_PI/2);
-                endPointSegment[1] = endPointSegment[1] - counter * firstRadius * std::sin(angleRadians + M_PI/2);
+                startPointSegment[0] = startPointSegment[0] - counter * firstRadius * lineNormal[0];
+                startPointSegment[1] = startPointSegment[1] - counter * firstRadius * lineNormal[1];
+                endPointSegment[0] = endPointSegment[0] - counter * firstRadius * lineNormal[0];
+                endPointSegment[1] = endPointSegment[1] - counter * firstRadius * lineNormal[1];
 
                 nextLine = std::make_shared<StraightLine>(
                     Eigen::Vector3d{startPointSegment[0], startPointSegment[1], 0}, 
@@ -305,12 +357,12 @@ std::shared_ptr<Path> PathFactory::NewRaceTrack(double angle, int direction, dou
     double angleSecondPointRad{};
 
     if(direction == RIGHT) {
-        angleFirstPointRad = DegToRad( ConvertToAngleInterval(angle + 60.0 - 90.0) );
-        angleSecondPointRad = DegToRad( ConvertToAngleInterval(angle + 120.0 - 90.0) ) ;
+        angleFirstPointRad = Geometry::DegToRad( Geometry::ConvertToAngleInterval(angle + 60.0 - 90.0) );
+        angleSecondPointRad = Geometry::DegToRad( Geometry::ConvertToAngleInterval(angle + 120.0 - 90.0) ) ;
     }
     else {
-        angleFirstPointRad = DegToRad( ConvertToAngleInterval(angle + 60.0 + 90.0) );
-        angleSecondPointRad = DegToRad( ConvertToAngleInterval(angle + 120.0 + 90.0) );
+        angleFirstPointRad = Geometry::DegToRad( Geometry::ConvertToAngleInterval(angle + 60.0 + 90.0) );
+        angleSecondPointRad = Geometry::DegToRad( Geometry::ConvertToAngleInterval(angle + 120.0 + 90.0) );
     }
 
     std::vector<Eigen::Vector3d> circlePoints {};
@@ -493,12 +545,16 @@ std::shared_ptr<Path> PathFactory::NewRaceTrack(double angle, int direction, dou
         circlePoints.clear();
         previousIntersectionsCounter = intersec.size();
     }
+
+    if(transitionLength > 0)
+        return AddClothoidTransitions(raceTrack, transitionLength);
     
       return raceTrack;
 }
 
 
-std::shared_ptr<Path> PathFactory::NewSerpentine(double angle, int direction, double offset, std::vector<Eigen::Vector3d>& polygonVerteces) {
+std::shared_ptr<Path> PathFactory::NewSerpentine(double angle, int direction, double offset, std::vector<Eigen::Vector3d>& polygonVerteces,
+    double transitionLength) {
 
     auto serpentine = std::make_shared<Path>();
 
@@ -508,7 +564,7 @@ std::shared_ptr<Path> PathFactory::NewSerpentine(double angle, int direction, do
 
     // Compute the rectangle surrounding the polygon
     double maxX{}; double minX{}; double maxY{}; double minY{};
-    std::tie(maxX, minX, maxY, minY) = evalRectangleBoundingBox(polygonVerteces);
+    std::tie(maxX, minX, maxY, minY) = Geometry::BoundingBox(polygonVerteces);
 
     const Eigen::Vector3d rectangleCentre {(maxX + minX) / 2, (maxY + minY) / 2, 0};
     std::vector<Eigen::Vector3d> rectangleVertices{Eigen::Vector3d{maxX, maxY, 0}, Eigen::Vector3d{maxX, minY, 0},
@@ -516,18 +572,21 @@ std::shared_ptr<Path> PathFactory::NewSerpentine(double angle, int direction, do
     auto rectangle = PathFactory::NewPolygon(rectangleVertices);
 
     // Transform the angle in the interval [0, 360)
-    angle = ConvertToAngleInterval(angle);
-    const double angleRadians {DegToRad(angle)};
-    const double rectangleDiagonal{std::sqrt(std::pow(maxX - minX, 2) + std::pow(maxY - minY, 2))}; // Eval lenght of the rectangle diagonal
+    angle = Geometry::ConvertToAngleInterval(angle);
+    const double angleRadians {Geometry::DegToRad(angle)};
+    // Direction of the sweep lines and their normal, the loops below only scale and shift them
+    const Eigen::Vector3d lineDirection {std::cos(angleRadians), std::sin(angleRadians), 0};
+    const Eigen::Vector3d lineNormal {-lineDirection[1], lineDirection[0], 0};
+    const double rectangleDiagonal{Geometry::Distance(rectangleVertices[0], rectangleVertices[2])}; // Eval lenght of the rectangle diagonal
 
 
     /** NOTE: Computation of the Starting Point of the Serpentine */
     auto polygonIntersRectangle = polygon->Intersection(rectangle);
     auto firstLine = std::make_shared<StraightLine>(
-        Eigen::Vector3d{rectangleCentre[0] - 2 * rectangleDiagonal * std::cos(angleRadians), 
-                        rectangleCentre[1] - 2 * rectangleDiagonal * std::sin(angleRadians), 0}, 
-        Eigen::Vector3d{rectangleCentre[0] + 2 * rectangleDiagonal * std::cos(angleRadians), 
-                        rectangleCentre[1] + 2 * rectangleDiagonal * std::sin(angleRadians), 0});
+        Eigen::Vector3d{rectangleCentre[0] - 2 * rectangleDiagonal * lineDirection[0], 
+                        rectangleCentre[1] - 2 * rectangleDiagonal * lineDirection[1], 0}, 
+        Eigen::Vector3d{rectangleCentre[0] + 2 * rectangleDiagonal * lineDirection[0], 
+                        rectangleCentre[1] + 2 * rectangleDiagonal * lineDirection[1], 0});
     auto nextLine = firstLine;
 
     double shiftingValue{2}; // Precision
@@ -539,17 +598,17 @@ std::shared_ptr<Path> PathFactory::NewSerpentine(double angle, int direction, do
 
         if(direction == RIGHT) {
             nextLine = std::make_shared<StraightLine>(
-                Eigen::Vector3d{rectangleCentre[0] - 2 * rectangleDiagonal * std::cos(angleRadians) - counter * shiftingValue * std::cos(angleRadians + M_PI/2), 
-                                rectangleCentre[1] - 2 * rectangleDiagonal * std::sin(angleRadians) - counter * shiftingValue * std::sin(angleRadians + M_PI/2), 0}, 
-                Eigen::Vector3d{rectangleCentre[0] + 2 * rectangleDiagonal * std::cos(angleRadians) - counter * shiftingValue * std::cos(angleRadians + M_PI/2), 
-                                rectangleCentre[1] + 2 * rectangleDiagonal * std::sin(angleRadians) - counter * shiftingValue * std::sin(angleRadians + M_PI/2), 0});
+                Eigen::Vector3d{rectangleCentre[0] - 2 * rectangleDiagonal * lineDirection[0] - counter * shiftingValue * lineNormal[0], 
+                                rectangleCentre[1] - 2 * rectangleDiagonal * lineDirection[1] - counter * shiftingValue * lineNormal[1], 0}, 
+                Eigen::Vector3d{rectangleCentre[0] + 2 * rectangleDiagonal * lineDirection[0] - counter * shiftingValue * lineNormal[0], 
+                                rectangleCentre[1] + 2 * rectangleDiagonal * lineDirection[1] - counter * shiftingValue * lineNormal[1], 0});
         }
         else {
             nextLine = std::make_shared<StraightLine>(
-                Eigen::Vector3d{rectangleCentre[0] - 2 * rectangleDiagonal * std::cos(angleRadians) + counter * shiftingValue * std::cos(angleRadians + M_PI/2), 
-                                rectangleCentre[1] - 2 * rectangleDiagonal * std::sin(angleRadians) + counter * shiftingValue * std::sin(angleRadians + M_PI/2), 0}, 
-                Eigen::Vector3d{rectangleCentre[0] + 2 * rectangleDiagonal * std::cos(angleRadians) + counter * shiftingValue * std::cos(angleRadians + M_PI/2), 
-                                rectangleCentre[1] + 2 * rectangleDiagonal * std::sin(angleRadians) + counter * shiftingValue * std::sin(angleRadians + M_PI/2), 0});
+                Eigen::Vector3d{rectangleCentre[0] - 2 * rectangleDiagonal * lineDirection[0] + counter * shiftingValue * lineNormal[0], 
+                                rectangleCentre[1] - 2 * rectangleDiagonal * lineDirection[1] + counter * shiftingValue * lineNormal[1], 0}, 
+                Eigen::Vector3d{rectangleCentre[0] + 2 * rectangleDiagonal * lineDirection[0] + counter * shiftingValue * lineNormal[0], 
+                                rectangleCentre[1] + 2 * rectangleDiagonal * lineDirection[1] + counter * shiftingValue * lineNormal[1], 0});
         }
         ++counter;
     }
@@ -574,11 +633,10 @@ std::shared_ptr<Path> PathFactory::NewSerpentine(double angle, int direction, do
             intersectionPoints.push_back(intersecTmp[0]);
         } 
         else {
-            double angleDirection = std::atan2(intersecTmp[1][1] - intersecTmp[0][1], intersecTmp[1][0] - intersecTmp[0][0]);
-            if(angleDirection < 0) angleDirection += 2*M_PI;
-            angleDirection = std::round(RadToDeg(angleDirection));
+            // Order of the intersections w.r.t. the direction of the sweep lines (no rounded angle comparison).
+            const bool alongSweep {(intersecTmp[1] - intersecTmp[0]).dot(lineDirection) > 0};
 
-            if(angleDirection == angle) {
+            if(alongSweep) {
                 if(changeDirection) {
                     intersectionPoints.push_back(intersecTmp[1]);
                     intersectionPoints.push_back(intersecTmp[0]);
@@ -603,17 +661,17 @@ std::shared_ptr<Path> PathFactory::NewSerpentine(double angle, int direction, do
         
         if(direction == RIGHT) {
             nextLine = std::make_shared<StraightLine>(
-                Eigen::Vector3d{startPointSegment[0] + counter * offset * std::cos(angleRadians + M_PI/2), 
-                                startPointSegment[1] + counter * offset * std::sin(angleRadians + M_PI/2), 0}, 
-                Eigen::Vector3d{endPointSegment[0] + counter * offset * std::cos(angleRadians + M_PI/2), 
-                                endPointSegment[1] + counter * offset * std::sin(angleRadians + M_PI/2), 0});
+                Eigen::Vector3d{startPointSegment[0] + counter * offset * lineNormal[0], 
+                                startPointSegment[1] + counter * offset * lineNormal[1], 0}, 
+                Eigen::Vector3d{endPointSegment[0] + counter * offset * lineNormal[0], 
+                                endPointSegment[1] + counter * offset * lineNormal[1], 0});
         }
         else {
             nextLine = std::make_shared<StraightLine>(
-                Eigen::Vector3d{startPointSegment[0] - counter * offset * std::cos(angleRadians + M_PI/2), 
-                                startPointSegment[1] - counter * offset * std::sin(angleRadians + M_PI/2), 0}, 
-                Eigen::Vector3d{endPointSegment[0] - counter * offset * std::cos(angleRadians + M_PI/2), 
-                                endPointSegment[1] - counter * offset * std::sin(angleRadians + M_PI/2), 0});
+                Eigen::Vector3d{startPointSegment[0] - counter * offset * lineNormal[0], 
+                                startPointSegment[1] - counter * offset * lineNormal[1], 0}, 
+                Eigen::Vector3d{endPointSegment[0] - counter * offset * lineNormal[0], 
+                                endPointSegment[1] - counter * offset * lineNormal[1], 0});
         }
 
         ++counter;
@@ -632,12 +690,12 @@ std::shared_ptr<Path> PathFactory::NewSerpentine(double angle, int direction, do
     double angleSecondPointRad{};
 
     if(direction == RIGHT) {
-        angleFirstPointRad = ConvertToAngleInterval(angle + 60.0 - 90.0) * M_PI / 180.0;
-        angleSecondPointRad = ConvertToAngleInterval(angle + 120.0 - 90.0) * M_PI / 180.0;
+        angleFirstPointRad = Geometry::DegToRad(Geometry::ConvertToAngleInterval(angle + 60.0 - 90.0));
+        angleSecondPointRad = Geometry::DegToRad(Geometry::ConvertToAngleInterval(angle + 120.0 - 90.0));
     }
     else {
-        angleFirstPointRad = ConvertToAngleInterval(angle + 60.0 + 90.0) * M_PI / 180.0;
-        angleSecondPointRad = ConvertToAngleInterval(angle + 120.0 + 90.0) * M_PI / 180.0;
+        angleFirstPointRad = Geometry::DegToRad(Geometry::ConvertToAngleInterval(angle + 60.0 + 90.0));
+        angleSecondPointRad = Geometry::DegToRad(Geometry::ConvertToAngleInterval(angle + 120.0 + 90.0));
     }
 
     std::vector<Eigen::Vector3d> circlePoints {};
@@ -765,7 +823,664 @@ std::shared_ptr<Path> PathFactory::NewSerpentine(double angle, int direction, do
         circlePoints.clear();
         previousIntersectionsCounter = intersec.size();
     }
+
+    if(transitionLength > 0)
+        return AddClothoidTransitions(serpentine, transitionLength);
     
     return serpentine;
 }
 
+
+std::shared_ptr<Path> PathFactory::NewRaceTrack(double angle, int direction, double firstRadius, double secondRadius, 
+    GeodeticFrame const& frame, std::vector<Eigen::Vector3d> const& geodeticVerteces, double transitionLength) {
+
+    auto polygonVerteces = frame.ToENU(geodeticVerteces);
+
+    // The polygon is built on the tangent plane (z = 0): the up component (the Earth curvature drop, -d^2 / 2R) would put
+    // its edges at different heights from the sweep lines, without intersections.
+    for(auto& vertex: polygonVerteces)
+        vertex[2] = 0;
+
+    return NewRaceTrack(angle, direction, firstRadius, secondRadius, polygonVerteces, transitionLength);
+}
+
+
+std::shared_ptr<Path> PathFactory::NewSerpentine(double angle, int direction, double offset, GeodeticFrame const& frame, 
+    std::vector<Eigen::Vector3d> const& geodeticVerteces, double transitionLength) {
+
+    auto polygonVerteces = frame.ToENU(geodeticVerteces);
+
+    // The polygon is built on the tangent plane (z = 0): the up component (the Earth curvature drop, -d^2 / 2R) would put
+    // its edges at different heights from the sweep lines, without intersections.
+    for(auto& vertex: polygonVerteces)
+        vertex[2] = 0;
+
+    return NewSerpentine(angle, direction, offset, polygonVerteces, transitionLength);
+}
+
+
+std::shared_ptr<Path> PathFactory::AddClothoidTransitions(std::shared_ptr<Path> path, double transitionLength) {
+
+    auto smoothPath = std::make_shared<Path>();
+
+    smoothPath->name_ = path->name_;
+
+    auto const& curves = path->curves_;
+
+    Eigen::Vector3d lineStart{Eigen::Vector3d::Zero()}; // Start point of the current straight line, if trimmed by the previous turn
+    bool trimmedStart{false};
+
+    for(std::size_t i = 0; i < curves.size(); ++i) {
+
+        auto line = std::dynamic_pointer_cast<StraightLine>(curves[i]);
+
+        if(!line or line->Length() == 0) {
+            smoothPath->AddCurveBack(curves[i]);
+            trimmedStart = false;
+            continue;
+        }
+
+        Eigen::Vector3d start {trimmedStart ? lineStart : line->StartPoint()};
+        trimmedStart = false;
+
+        std::shared_ptr<CircularArc> arc;
+        std::shared_ptr<StraightLine> nextLine;
+        if(i + 2 < curves.size()) {
+            arc = std::dynamic_pointer_cast<CircularArc>(curves[i + 1]);
+            nextLine = std::dynamic_pointer_cast<StraightLine>(curves[i + 2]);
+        }
+
+        if(arc and nextLine and nextLine->Length() > 0) {
+
+            Eigen::Vector3d firstDirection {(line->EndPoint() - line->StartPoint()).normalized()};
+            Eigen::Vector3d secondDirection {(nextLine->EndPoint() - nextLine->StartPoint()).normalized()};
+            Eigen::Vector3d centre {arc->CentrePoint()};
+
+            // Projections of the arc centre on the two straight lines
+            Eigen::Vector3d firstFoot {line->StartPoint() + (centre - line->StartPoint()).dot(firstDirection) * firstDirection};
+            Eigen::Vector3d secondFoot {nextLine->StartPoint() + (centre - nextLine->StartPoint()).dot(secondDirection) * secondDirection};
+
+            double radius {(centre - firstFoot).norm()};
+            double turn {(firstDirection.cross(centre - firstFoot)[2] > 0) ? 1.0 : -1.0}; // +1 counterclockwise, -1 clockwise
+            double deflection {std::atan2(turn * firstDirection.cross(secondDirection)[2], firstDirection.dot(secondDirection))};
+            if(deflection < 0) deflection += 2 * M_PI;
+
+            // Reduce the radius until the clothoid shift compensates it: the centre stays at distance radius from the lines.
+            double reducedRadius {radius};
+            double tangentOffset {0};
+            double shift {0};
+            for(int k = 0; k < 50 and reducedRadius > 0; ++k) {
+                std::tie(tangentOffset, shift) = Clothoid::TransitionOffsets(reducedRadius, transitionLength);
+                double nextRadius {radius - shift};
+                bool converged {std::abs(nextRadius - reducedRadius) < 1e-12 * radius};
+                reducedRadius = nextRadius;
+                if(converged) break;
+            }
+
+            bool feasible {radius > 0 and reducedRadius > 0 and std::abs((centre - secondFoot).norm() - radius) < 1e-2 * radius};
+            double tau {0};
+            double arcAngle {0};
+
+            if(feasible) {
+                std::tie(tangentOffset, shift) = Clothoid::TransitionOffsets(reducedRadius, transitionLength);
+                tau = transitionLength / (2 * reducedRadius);
+                arcAngle = deflection - 2 * tau;
+
+                feasible = arcAngle > -1e-9 
+                    and tangentOffset < (firstFoot - start).dot(firstDirection)
+                    and tangentOffset < (nextLine->EndPoint() - secondFoot).dot(secondDirection);
+            }
+
+            if(feasible) {
+
+                Eigen::Vector3d clothoidStart {firstFoot - tangentOffset * firstDirection};
+                double heading {std::atan2(firstDirection[1], firstDirection[0])};
+
+                if((clothoidStart - start).norm() > 0)
+                    smoothPath->AddCurveBack(std::make_shared<StraightLine>(start, clothoidStart));
+
+                auto entry = std::make_shared<Clothoid>(clothoidStart, heading, 0, turn / reducedRadius, transitionLength);
+                smoothPath->AddCurveBack(entry);
+
+                Eigen::Vector3d exitStart {entry->EndPoint()};
+                if(arcAngle > 1e-9) {
+                    smoothPath->AddCurveBack(std::make_shared<CircularArc>(turn * arcAngle, Eigen::Vector3d{0, 0, 1}, exitStart, centre));
+                    exitStart = smoothPath->LastCurve()->EndPoint();
+                }
+
+                auto exit = std::make_shared<Clothoid>(exitStart, heading + turn * (deflection - tau), turn / reducedRadius, 0, transitionLength);
+                smoothPath->AddCurveBack(exit);
+
+                lineStart = exit->EndPoint();
+                trimmedStart = true;
+                ++i; // The arc has been replaced
+                continue;
+            }
+        }
+
+        if(start == line->StartPoint())
+            smoothPath->AddCurveBack(line);
+        else if((line->EndPoint() - start).norm() > 0)
+            smoothPath->AddCurveBack(std::make_shared<StraightLine>(start, line->EndPoint()));
+    }
+
+    return smoothPath;
+}
+
+
+PathFactory::Corner PathFactory::CornerGeometry(Eigen::Vector3d const& previous, Eigen::Vector3d const& vertex, 
+    Eigen::Vector3d const& next, double radius, double transitionLength) {
+
+    Corner corner;
+    corner.entry = vertex;
+    corner.exit = vertex;
+
+    double firstLength {Geometry::Distance(previous, vertex)};
+    double secondLength {Geometry::Distance(vertex, next)};
+    if(firstLength == 0 or secondLength == 0)
+        return corner;
+
+    Eigen::Vector3d firstDirection {(vertex - previous) / firstLength};
+    Eigen::Vector3d secondDirection {(next - vertex) / secondLength};
+    Eigen::Vector3d axis {firstDirection.cross(secondDirection)};
+
+    // Collinear segments: nothing to round. Reversal: no tangent circle exists.
+    if(axis.norm() < 1e-9)
+        return corner;
+
+    corner.rounded = true;
+    corner.axis = axis.normalized();
+    corner.deflection = std::atan2(axis.norm(), firstDirection.dot(secondDirection));
+    corner.inward = corner.axis.cross(firstDirection);
+    corner.heading = std::atan2(firstDirection[1], firstDirection[0]);
+    corner.turn = corner.axis[2] > 0 ? 1.0 : -1.0;
+    double halfTangent {std::tan(corner.deflection / 2)};
+
+    // Each corner may use at most half of the adjacent segments.
+    double maxTangentLength {0.5 * std::min(firstLength, secondLength)};
+
+    // Clothoid -> arc -> clothoid, only on horizontal corners (the clothoids are planar).
+    if(transitionLength > 0 and std::abs(corner.axis[2]) > 1 - 1e-9) {
+
+        double tau {transitionLength / (2 * radius)};
+        double tangentOffset {0};
+        double shift {0};
+        std::tie(tangentOffset, shift) = Clothoid::TransitionOffsets(radius, transitionLength);
+
+        double tangentLength {(radius + shift) * halfTangent + tangentOffset};
+
+        if(corner.deflection >= 2 * tau and tangentLength <= maxTangentLength) {
+
+            Eigen::Vector3d foot {vertex - (radius + shift) * halfTangent * firstDirection};
+
+            corner.transitions = true;
+            corner.radius = radius;
+            corner.transitionAngle = tau;
+            corner.arcAngle = corner.deflection - 2 * tau;
+            corner.centre = foot + (radius + shift) * corner.inward;
+            corner.entry = vertex - tangentLength * firstDirection;
+            corner.exit = vertex + tangentLength * secondDirection;
+
+            return corner;
+        }
+    }
+
+    // Tangent circular arc, with the radius reduced if it does not fit.
+    double tangentLength {radius * halfTangent};
+    if(tangentLength > maxTangentLength) {
+        tangentLength = maxTangentLength;
+        radius = tangentLength / halfTangent;
+    }
+
+    corner.radius = radius;
+    corner.arcAngle = corner.deflection;
+    corner.entry = vertex - tangentLength * firstDirection;
+    corner.exit = vertex + tangentLength * secondDirection;
+    corner.centre = corner.entry + radius * corner.inward;
+
+    return corner;
+}
+
+
+std::vector<std::shared_ptr<Curve>> PathFactory::RoundCorner(Eigen::Vector3d const& previous, Eigen::Vector3d const& vertex, 
+    Eigen::Vector3d const& next, double radius, double transitionLength, Eigen::Vector3d& entry, Eigen::Vector3d& exit) {
+
+    std::vector<std::shared_ptr<Curve>> corner;
+    const Corner geometry {CornerGeometry(previous, vertex, next, radius, transitionLength)};
+    entry = geometry.entry;
+    exit = geometry.exit;
+
+    if(not geometry.rounded)
+        return corner;
+
+    if(not geometry.transitions) {
+        corner.push_back(std::make_shared<CircularArc>(geometry.deflection, geometry.axis, entry, geometry.centre));
+        return corner;
+    }
+
+    const double turn {geometry.turn};
+
+    auto entryClothoid = std::make_shared<Clothoid>(entry, geometry.heading, 0, turn / geometry.radius, transitionLength);
+    corner.push_back(entryClothoid);
+
+    Eigen::Vector3d exitStart {entryClothoid->EndPoint()};
+    if(geometry.arcAngle > 1e-9) {
+        corner.push_back(std::make_shared<CircularArc>(turn * geometry.arcAngle, Eigen::Vector3d{0, 0, 1}, exitStart, 
+            geometry.centre));
+        exitStart = corner.back()->EndPoint();
+    }
+
+    corner.push_back(std::make_shared<Clothoid>(exitStart, geometry.heading + turn * (geometry.deflection - geometry.transitionAngle), 
+        turn / geometry.radius, 0, transitionLength));
+
+    return corner;
+}
+
+
+std::shared_ptr<Path> PathFactory::RoundCorners(std::vector<Eigen::Vector3d> const& points, double radius, double transitionLength, 
+    bool closed) {
+
+    const int pointsNumber {static_cast<int>(points.size())};
+    // Vertices that are corners: all for a polygon, the inner ones for a polygonal chain.
+    const int firstCorner {closed ? 0 : 1};
+    const int lastCorner {closed ? pointsNumber - 1 : pointsNumber - 2};
+    const int cornersNumber {std::max(0, lastCorner - firstCorner + 1)};
+
+    std::vector<std::vector<std::shared_ptr<Curve>>> corners(cornersNumber);
+    std::vector<Eigen::Vector3d> entries(cornersNumber);
+    std::vector<Eigen::Vector3d> exits(cornersNumber);
+
+    // The corners are independent of each other: analytic computation, one corner per iteration.
+    bool failed {false};
+    std::string errorMessage {};
+
+    #pragma omp parallel for schedule(static)
+    for(int k = 0; k < cornersNumber; ++k) {
+        int i {firstCorner + k};
+        auto const& previous = points[(i + pointsNumber - 1) % pointsNumber];
+        auto const& next = points[(i + 1) % pointsNumber];
+        try {
+            corners[k] = RoundCorner(previous, points[i], next, radius, transitionLength, entries[k], exits[k]);
+        } catch (std::runtime_error const& exception) {
+            #pragma omp critical
+            {
+                failed = true;
+                errorMessage = exception.what();
+            }
+        }
+    }
+
+    if(failed)
+        throw std::runtime_error(std::string("[PathFactory::RoundCorners] -> ") + errorMessage);
+
+    auto path = std::make_shared<Path>();
+
+    auto addLine = [&path](Eigen::Vector3d const& start, Eigen::Vector3d const& end) {
+        if(Geometry::Distance(start, end) > 0)
+            path->AddCurveBack(std::make_shared<StraightLine>(start, end));
+    };
+
+    if(closed) {
+        for(int k = 0; k < cornersNumber; ++k) {
+            int nextCorner {(k + 1) % cornersNumber};
+            addLine(exits[k], entries[nextCorner]);
+            for(auto const& curve: corners[nextCorner])
+                path->AddCurveBack(curve);
+        }
+    }
+    else {
+        Eigen::Vector3d start {points.front()};
+        for(int k = 0; k < cornersNumber; ++k) {
+            addLine(start, entries[k]);
+            for(auto const& curve: corners[k])
+                path->AddCurveBack(curve);
+            start = exits[k];
+        }
+        addLine(start, points.back());
+    }
+
+    return path;
+}
+
+
+constexpr const char* PathFactory::DubinsWords[6];
+
+
+bool PathFactory::DubinsWord(int word, double alpha, double beta, double distance, std::array<double, 3>& lengths) {
+
+    const double d {distance};
+    const double sinA {std::sin(alpha)};
+    const double sinB {std::sin(beta)};
+    const double cosA {std::cos(alpha)};
+    const double cosB {std::cos(beta)};
+    const double cosAB {std::cos(alpha - beta)};
+
+    double squared {0};
+    double angle {0};
+
+    switch(word) {
+        case 0: // LSL
+            squared = 2 + d * d - 2 * cosAB + 2 * d * (sinA - sinB);
+            if(squared < 0) return false;
+            angle = std::atan2(cosB - cosA, d + sinA - sinB);
+            lengths = {Geometry::ConvertToRadInterval(-alpha + angle), std::sqrt(squared), Geometry::ConvertToRadInterval(beta - angle)};
+            return true;
+
+        case 1: // RSR
+            squared = 2 + d * d - 2 * cosAB + 2 * d * (sinB - sinA);
+            if(squared < 0) return false;
+            angle = std::atan2(cosA - cosB, d - sinA + sinB);
+            lengths = {Geometry::ConvertToRadInterval(alpha - angle), std::sqrt(squared), Geometry::ConvertToRadInterval(-beta + angle)};
+            return true;
+
+        case 2: // LSR
+            squared = -2 + d * d + 2 * cosAB + 2 * d * (sinA + sinB);
+            if(squared < 0) return false;
+            angle = std::atan2(-cosA - cosB, d + sinA + sinB) - std::atan2(-2.0, std::sqrt(squared));
+            lengths = {Geometry::ConvertToRadInterval(-alpha + angle), std::sqrt(squared), Geometry::ConvertToRadInterval(-beta + angle)};
+            return true;
+
+        case 3: // RSL
+            squared = -2 + d * d + 2 * cosAB - 2 * d * (sinA + sinB);
+            if(squared < 0) return false;
+            angle = std::atan2(cosA + cosB, d - sinA - sinB) - std::atan2(2.0, std::sqrt(squared));
+            lengths = {Geometry::ConvertToRadInterval(alpha - angle), std::sqrt(squared), Geometry::ConvertToRadInterval(beta - angle)};
+            return true;
+
+        case 4: { // RLR
+            double cosP {(6 - d * d + 2 * cosAB + 2 * d * (sinA - sinB)) / 8};
+            if(std::abs(cosP) > 1) return false;
+            double p {Geometry::ConvertToRadInterval(2 * M_PI - std::acos(cosP))};
+            double t {Geometry::ConvertToRadInterval(alpha - std::atan2(cosA - cosB, d - sinA + sinB) + p / 2)};
+            lengths = {t, p, Geometry::ConvertToRadInterval(alpha - beta - t + p)};
+            return true;
+        }
+
+        case 5: { // LRL
+            double cosP {(6 - d * d + 2 * cosAB + 2 * d * (sinB - sinA)) / 8};
+            if(std::abs(cosP) > 1) return false;
+            double p {Geometry::ConvertToRadInterval(2 * M_PI - std::acos(cosP))};
+            double t {Geometry::ConvertToRadInterval(-alpha - std::atan2(cosA - cosB, d + sinA - sinB) + p / 2)};
+            lengths = {t, p, Geometry::ConvertToRadInterval(beta - alpha - t + p)};
+            return true;
+        }
+
+        default:
+            return false;
+    }
+}
+
+
+int PathFactory::ShortestDubinsWord(Eigen::Vector3d const& startPoint, double startHeading, Eigen::Vector3d const& endPoint, 
+    double endHeading, double radius, std::array<double, 3>& lengths) {
+
+    if(radius <= 0)
+        throw std::runtime_error("[PathFactory::ShortestDubinsWord] Input parameter error. radius must be positive");
+
+    const double dx {endPoint[0] - startPoint[0]};
+    const double dy {endPoint[1] - startPoint[1]};
+    const double theta {std::atan2(dy, dx)};
+
+    const double alpha {Geometry::ConvertToRadInterval(startHeading - theta)};
+    const double beta {Geometry::ConvertToRadInterval(endHeading - theta)};
+    const double distance {std::sqrt(dx * dx + dy * dy) / radius};
+
+    int bestWord {-1};
+    double bestLength {std::numeric_limits<double>::infinity()};
+    std::array<double, 3> wordLengths {};
+
+    for(int word = 0; word < 6; ++word) {
+        if(DubinsWord(word, alpha, beta, distance, wordLengths)) {
+            double length {wordLengths[0] + wordLengths[1] + wordLengths[2]};
+            if(length < bestLength) {
+                bestLength = length;
+                bestWord = word;
+                lengths = wordLengths;
+            }
+        }
+    }
+
+    return bestWord;
+}
+
+
+double PathFactory::DubinsLength(Eigen::Vector3d const& startPoint, double startHeading, Eigen::Vector3d const& endPoint, 
+    double endHeading, double radius) {
+
+    std::array<double, 3> lengths {};
+
+    try {
+        if(ShortestDubinsWord(startPoint, startHeading, endPoint, endHeading, radius, lengths) < 0)
+            throw std::runtime_error("No feasible word");
+    } catch (std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[PathFactory::DubinsLength] -> ") + exception.what());
+    }
+
+    return (lengths[0] + lengths[1] + lengths[2]) * radius;
+}
+
+
+std::shared_ptr<Path> PathFactory::NewDubinsPath(Eigen::Vector3d startPoint, double startHeading, Eigen::Vector3d endPoint, 
+    double endHeading, double radius) {
+
+    std::array<double, 3> lengths {};
+    int word {-1};
+
+    try {
+        word = ShortestDubinsWord(startPoint, startHeading, endPoint, endHeading, radius, lengths);
+        if(word < 0)
+            throw std::runtime_error("No feasible word");
+    } catch (std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[PathFactory::NewDubinsPath] -> ") + exception.what());
+    }
+
+    auto dubins = std::make_shared<Path>();
+    dubins->name_ = std::string("Dubins ") + DubinsWords[word];
+
+    // The poses along the path are propagated in closed form, the curves only describe the segments.
+    Eigen::Vector3d position {startPoint};
+    double heading {startHeading};
+    const double minLength {1e-9};
+
+    for(int i = 0; i < 3; ++i) {
+
+        char segment {DubinsWords[word][i]};
+        Eigen::Vector3d direction {std::cos(heading), std::sin(heading), 0};
+
+        if(segment == 'S') {
+            Eigen::Vector3d segmentEnd {position + lengths[i] * radius * direction};
+            if(lengths[i] * radius > minLength)
+                dubins->AddCurveBack(std::make_shared<StraightLine>(position, segmentEnd));
+            position = segmentEnd;
+        }
+        else {
+            double turn {segment == 'L' ? 1.0 : -1.0};
+            Eigen::Vector3d left {-direction[1], direction[0], 0};
+            Eigen::Vector3d centre {position + turn * radius * left};
+
+            if(lengths[i] * radius > minLength)
+                dubins->AddCurveBack(std::make_shared<CircularArc>(turn * lengths[i], Eigen::Vector3d{0, 0, 1}, position, centre));
+
+            heading += turn * lengths[i];
+            position = centre - turn * radius * Eigen::Vector3d{-std::sin(heading), std::cos(heading), 0};
+        }
+    }
+
+    return dubins;
+}
+
+
+std::shared_ptr<PlanarPath> PathFactory::NewPlanarPolygonalChain(std::vector<Eigen::Vector2d> const& points) {
+
+    if(points.size() < 2)
+        throw std::runtime_error("[PathFactory::NewPlanarPolygonalChain] Wrong number of points! Received a vector of size " 
+            + std::to_string(points.size()) + ", while expecting one of at least size 2.");
+
+    auto polygonalChain = std::make_shared<PlanarPath>();
+    polygonalChain->name_ = "Polygonal Chain";
+
+    for(std::size_t i = 0; i + 1 < points.size(); ++i)
+        polygonalChain->AddLine(points[i], points[i + 1]);
+
+    return polygonalChain;
+}
+
+
+std::shared_ptr<PlanarPath> PathFactory::NewPlanarPolygon(std::vector<Eigen::Vector2d> const& points) {
+
+    if(points.size() < 3)
+        throw std::runtime_error("[PathFactory::NewPlanarPolygon] Wrong number of points! Received a vector of size " 
+            + std::to_string(points.size()) + ", while expecting one of at least size 3.");
+
+    auto polygon = std::make_shared<PlanarPath>();
+    polygon->name_ = "Polygon";
+
+    for(std::size_t i = 0; i < points.size(); ++i)
+        polygon->AddLine(points[i], points[(i + 1) % points.size()]);
+
+    return polygon;
+}
+
+
+std::shared_ptr<PlanarPath> PathFactory::NewPlanarRoundedPolygonalChain(std::vector<Eigen::Vector2d> const& points, double radius, 
+    double transitionLength) {
+
+    if(points.size() < 2)
+        throw std::runtime_error("[PathFactory::NewPlanarRoundedPolygonalChain] Wrong number of points! Received a vector of size " 
+            + std::to_string(points.size()) + ", while expecting one of at least size 2.");
+    if(radius <= 0)
+        throw std::runtime_error("[PathFactory::NewPlanarRoundedPolygonalChain] Input parameter error. radius must be positive");
+
+    auto polygonalChain = RoundPlanarCorners(points, radius, transitionLength, false);
+    polygonalChain->name_ = "Rounded Polygonal Chain";
+
+    return polygonalChain;
+}
+
+
+std::shared_ptr<PlanarPath> PathFactory::NewPlanarRoundedPolygon(std::vector<Eigen::Vector2d> const& points, double radius, 
+    double transitionLength) {
+
+    if(points.size() < 3)
+        throw std::runtime_error("[PathFactory::NewPlanarRoundedPolygon] Wrong number of points! Received a vector of size " 
+            + std::to_string(points.size()) + ", while expecting one of at least size 3.");
+    if(radius <= 0)
+        throw std::runtime_error("[PathFactory::NewPlanarRoundedPolygon] Input parameter error. radius must be positive");
+
+    auto polygon = RoundPlanarCorners(points, radius, transitionLength, true);
+    polygon->name_ = "Rounded Polygon";
+
+    return polygon;
+}
+
+
+void PathFactory::RoundPlanarCorner(Eigen::Vector2d const& previous, Eigen::Vector2d const& vertex, Eigen::Vector2d const& next, 
+    double radius, double transitionLength, PlanarPath& corner, Eigen::Vector2d& entry, Eigen::Vector2d& exit) {
+
+    const Corner geometry {CornerGeometry(Eigen::Vector3d{previous[0], previous[1], 0}, Eigen::Vector3d{vertex[0], vertex[1], 0}, 
+        Eigen::Vector3d{next[0], next[1], 0}, radius, transitionLength)};
+    entry = geometry.entry.head<2>();
+    exit = geometry.exit.head<2>();
+
+    if(not geometry.rounded)
+        return;
+
+    const double curvature {geometry.turn / geometry.radius};
+
+    if(not geometry.transitions) {
+        corner.AddArc(entry, geometry.heading, curvature, geometry.deflection * geometry.radius);
+        return;
+    }
+
+    corner.AddClothoid(entry, geometry.heading, 0, curvature, transitionLength);
+
+    if(geometry.arcAngle > 1e-9)
+        corner.AddArc(corner.EndPoint(), corner.EndHeading(), curvature, geometry.arcAngle * geometry.radius);
+
+    corner.AddClothoid(corner.EndPoint(), corner.EndHeading(), curvature, 0, transitionLength);
+}
+
+
+std::shared_ptr<PlanarPath> PathFactory::RoundPlanarCorners(std::vector<Eigen::Vector2d> const& points, double radius, 
+    double transitionLength, bool closed) {
+
+    const int pointsNumber {static_cast<int>(points.size())};
+    // Vertices that are corners: all for a polygon, the inner ones for a polygonal chain.
+    const int firstCorner {closed ? 0 : 1};
+    const int lastCorner {closed ? pointsNumber - 1 : pointsNumber - 2};
+    const int cornersNumber {std::max(0, lastCorner - firstCorner + 1)};
+
+    std::vector<PlanarPath> corners(cornersNumber);
+    std::vector<Eigen::Vector2d> entries(cornersNumber);
+    std::vector<Eigen::Vector2d> exits(cornersNumber);
+
+    #pragma omp parallel for schedule(static)
+    for(int k = 0; k < cornersNumber; ++k) {
+        int i {firstCorner + k};
+        auto const& previous = points[(i + pointsNumber - 1) % pointsNumber];
+        auto const& next = points[(i + 1) % pointsNumber];
+        RoundPlanarCorner(previous, points[i], next, radius, transitionLength, corners[k], entries[k], exits[k]);
+    }
+
+    auto path = std::make_shared<PlanarPath>();
+
+    if(closed) {
+        for(int k = 0; k < cornersNumber; ++k) {
+            int nextCorner {(k + 1) % cornersNumber};
+            path->AddLine(exits[k], entries[nextCorner]);
+            for(auto const& segment: corners[nextCorner].Segments())
+                path->AddSegment(segment);
+        }
+    }
+    else {
+        Eigen::Vector2d start {points.front()};
+        for(int k = 0; k < cornersNumber; ++k) {
+            path->AddLine(start, entries[k]);
+            for(auto const& segment: corners[k].Segments())
+                path->AddSegment(segment);
+            start = exits[k];
+        }
+        path->AddLine(start, points.back());
+    }
+
+    return path;
+}
+
+
+std::shared_ptr<PlanarPath> PathFactory::NewPlanarDubinsPath(Eigen::Vector2d const& startPoint, double startHeading, 
+    Eigen::Vector2d const& endPoint, double endHeading, double radius) {
+
+    std::array<double, 3> lengths {};
+    int word {-1};
+
+    try {
+        word = ShortestDubinsWord(Eigen::Vector3d{startPoint[0], startPoint[1], 0}, startHeading, 
+            Eigen::Vector3d{endPoint[0], endPoint[1], 0}, endHeading, radius, lengths);
+        if(word < 0)
+            throw std::runtime_error("No feasible word");
+    } catch (std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[PathFactory::NewPlanarDubinsPath] -> ") + exception.what());
+    }
+
+    auto dubins = std::make_shared<PlanarPath>();
+    dubins->name_ = std::string("Dubins ") + DubinsWords[word];
+
+    Eigen::Vector2d position {startPoint};
+    double heading {startHeading};
+    const double minLength {1e-9};
+
+    for(int i = 0; i < 3; ++i) {
+
+        char segment {DubinsWords[word][i]};
+        double length {lengths[i] * radius};
+        double curvature {segment == 'S' ? 0.0 : (segment == 'L' ? 1.0 : -1.0) / radius};
+
+        if(length > minLength)
+            dubins->AddSegment(PlanarPath::Segment{position, heading, curvature, 0, length});
+
+        position = PlanarPath::SegmentAt(PlanarPath::Segment{position, heading, curvature, 0, length}, length);
+        heading += curvature * length;
+    }
+
+    return dubins;
+}
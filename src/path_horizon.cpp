@@ -0,0 +1,200 @@
+#include "sisl_toolbox/path_horizon.hpp"
+
+#include "sisl_toolbox/path.hpp"
+#include "sisl_toolbox/curve.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+
+constexpr int PathHorizon::minimumRelease_;
+
+
+PathHorizon::PathHorizon(std::shared_ptr<Path> mission, double horizon_m, double lookahead_m, bool releaseConsumed)
+: mission_{mission}
+, window_{std::make_shared<Path>()}
+, horizon_m_{horizon_m}
+, lookahead_m_{lookahead_m}
+, releaseConsumed_{releaseConsumed}
+, abscissa_m_{0}
+, windowStart_m_{0}
+, missionLength_m_{0}
+, nextCurve_{0}
+{
+    if(mission_ == nullptr)
+        throw std::runtime_error("[PathHorizon::PathHorizon] Input parameter error. The mission is null");
+    if(mission_->CurvesNumber() == 0)
+        throw std::runtime_error("[PathHorizon::PathHorizon] Input parameter error. The mission is empty");
+    if(horizon_m <= 0)
+        throw std::runtime_error("[PathHorizon::PathHorizon] Input parameter error. horizon_m must be positive");
+    if(lookahead_m < 0)
+        throw std::runtime_error("[PathHorizon::PathHorizon] Input parameter error. lookahead_m must not be negative");
+
+    missionLength_m_ = mission_->Length();
+    window_->name_ = mission_->name_;
+
+    // The segment kernel exists from the start: the curves entering the window update it as they are loaded.
+    window_->Kernel();
+    Slide();
+}
+
+
+void PathHorizon::Slide()
+{
+    Path const& mission{*mission_};
+    Path const& window{*window_};
+
+    // Curves fully behind the vehicle leave the window (the one containing the vehicle is kept)
+    int behind{0};
+    double behindLength_m{0};
+    while(behind < window.CurvesNumber() and windowStart_m_ + behindLength_m + window[behind]->Length() < abscissa_m_) {
+        behindLength_m += window[behind]->Length();
+        ++behind;
+    }
+    if(behind > 0) {
+        window_->Erase(0, behind);
+        windowStart_m_ += behindLength_m;
+    }
+
+    // After a jump beyond the window the curves behind the vehicle are skipped without loading them
+    while(window.CurvesNumber() == 0 and nextCurve_ < mission.CurvesNumber()
+        and windowStart_m_ + mission[nextCurve_]->Length() < abscissa_m_) {
+        windowStart_m_ += mission[nextCurve_]->Length();
+        ++nextCurve_;
+    }
+
+    // Curves ahead enter the window up to the horizon plus the lookahead
+    while(nextCurve_ < mission.CurvesNumber() and windowStart_m_ + window.Length() < abscissa_m_ + horizon_m_ + lookahead_m_) {
+        window_->AddCurveBack(mission[nextCurve_]);
+        ++nextCurve_;
+    }
+
+    // Release the consumed curves when they are at least as many as the remaining ones: each erase shifts the mission
+    // curves once, paid by the curves released.
+    const int consumed{nextCurve_ - window.CurvesNumber()};
+    if(releaseConsumed_ and consumed >= std::max(minimumRelease_, mission.CurvesNumber() - consumed)) {
+        mission_->Erase(0, consumed);
+        nextCurve_ -= consumed;
+    }
+}
+
+
+void PathHorizon::Advance(double abscissa_m)
+{
+    if(abscissa_m < windowStart_m_)
+        throw std::runtime_error("[PathHorizon::Advance] Input parameter error. abscissa_m before the window (released)");
+    if(abscissa_m > missionLength_m_)
+        throw std::runtime_error("[PathHorizon::Advance] Input parameter error. abscissa_m beyond the mission end");
+
+    abscissa_m_ = abscissa_m;
+
+    try {
+        Slide();
+    } catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[PathHorizon::Advance] -> ") + exception.what());
+    }
+}
+
+
+double PathHorizon::Track(Eigen::Vector3d& worldF_position)
+{
+    double abscissa_m{0};
+
+    try {
+        FindClosestPoint(worldF_position, abscissa_m);
+        if(abscissa_m > abscissa_m_)
+            Advance(abscissa_m);
+    } catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[PathHorizon::Track] -> ") + exception.what());
+    }
+
+    return abscissa_m_;
+}
+
+
+double PathHorizon::WindowEnd() const
+{
+    return std::min(abscissa_m_ + horizon_m_, std::min(windowStart_m_ + window_->Length(), missionLength_m_));
+}
+
+
+double PathHorizon::ToLocalAbscissa(double abscissa_m, char const* method) const
+{
+    if(abscissa_m < abscissa_m_)
+        throw std::runtime_error(std::string("[PathHorizon::") + method + "] Input parameter error. abscissa_m behind the vehicle");
+    if(abscissa_m > WindowEnd())
+        throw std::runtime_error(std::string("[PathHorizon::") + method + "] Input parameter error. abscissa_m beyond the horizon");
+
+    return std::min(std::max(abscissa_m - windowStart_m_, 0.0), window_->Length());
+}
+
+
+Eigen::Vector3d PathHorizon::At(double abscissa_m)
+{
+    const double localAbscissa_m{ToLocalAbscissa(abscissa_m, "At")};
+
+    try {
+        return window_->At(localAbscissa_m);
+    } catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[PathHorizon::At] -> ") + exception.what());
+    }
+}
+
+
+std::vector<Eigen::Vector3d> PathHorizon::Derivate(int order, double abscissa_m)
+{
+    const double localAbscissa_m{ToLocalAbscissa(abscissa_m, "Derivate")};
+
+    try {
+        return window_->Derivate(order, localAbscissa_m);
+    } catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[PathHorizon::Derivate] -> ") + exception.what());
+    }
+}
+
+
+double PathHorizon::Curvature(double abscissa_m)
+{
+    const double localAbscissa_m{ToLocalAbscissa(abscissa_m, "Curvature")};
+
+    try {
+        return window_->Curvature(localAbscissa_m);
+    } catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[PathHorizon::Curvature] -> ") + exception.what());
+    }
+}
+
+
+Eigen::Vector3d PathHorizon::FindClosestPoint(Eigen::Vector3d& worldF_position, double& abscissa_m)
+{
+    const double localStart_m{ToLocalAbscissa(abscissa_m_, "FindClosestPoint")};
+    const double localEnd_m{ToLocalAbscissa(WindowEnd(), "FindClosestPoint")};
+
+    int curveId{0};
+    double abscissaCurve_m{0};
+    double distance{0};
+
+    try {
+        std::tie(curveId, abscissaCurve_m, distance) = window_->FindClosestCurveOnInterval(worldF_position, localStart_m,
+            localEnd_m);
+
+        // Only degenerate (null length) curves
+        if(curveId < 0) {
+            abscissa_m = abscissa_m_;
+            return window_->At(localStart_m);
+        }
+
+        abscissa_m = std::min(std::max(windowStart_m_ + window_->PathAbscissa(curveId, abscissaCurve_m), abscissa_m_), WindowEnd());
+        return window_->curves_[curveId]->At(abscissaCurve_m);
+    } catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[PathHorizon::FindClosestPoint] -> ") + exception.what());
+    }
+}
+
+
+PathView PathHorizon::View() const
+{
+    return PathView(window_, ToLocalAbscissa(abscissa_m_, "View"), ToLocalAbscissa(WindowEnd(), "View"));
+}
@@ -0,0 +1,192 @@
+#include "sisl_toolbox/path_profile.hpp"
+
+#include "sisl_toolbox/path.hpp"
+#include "sisl_toolbox/curve.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+
+PathProfile::PathProfile(std::shared_ptr<Path> path, double step)
+    : step_{step}
+    , startParameter_m_{0}
+    , endParameter_m_{0}
+{
+    if(path == nullptr or path->CurvesNumber() == 0)
+        throw std::runtime_error("[PathProfile::PathProfile] Input parameter error. Empty path");
+    if(step <= 0)
+        throw std::runtime_error("[PathProfile::PathProfile] Input parameter error. step must be positive");
+
+    startParameter_m_ = path->StartParameter();
+    endParameter_m_ = path->EndParameter();
+
+    intervals_.reserve(static_cast<std::size_t>((endParameter_m_ - startParameter_m_) / step_) + path->CurvesNumber() + 1);
+
+    // Exact values on a curve, with the sign of the curvature given by the z component of the turn.
+    auto evaluate = [](std::shared_ptr<Curve> const& curve, double abscissaCurve_m, Interval& sample) {
+        Eigen::Vector3d tangent{};
+        Eigen::Vector3d normal{};
+        Eigen::Vector3d binormal{};
+
+        sample.position = curve->At(abscissaCurve_m);
+        curve->EvalTangentFrame(abscissaCurve_m, tangent, normal, binormal);
+        sample.heading = std::atan2(tangent[1], tangent[0]);
+
+        auto derivates = curve->Derivate(2, abscissaCurve_m);
+        sample.curvature = curve->Curvature(abscissaCurve_m);
+        if(derivates[0].cross(derivates[1])[2] < 0)
+            sample.curvature = -sample.curvature;
+    };
+
+    const double minInterval{1e-9 * step_}; // Grid points closer than this to a curve boundary are skipped
+    double curveStart_m{startParameter_m_};
+    double previousHeading{0};
+    bool first{true};
+
+    std::vector<double> breakpoints;
+    std::vector<Interval> samples;
+
+    for(auto const& curve: path->Curves()) {
+
+        const double curveEnd_m{curveStart_m + curve->Length()};
+        if(curve->Length() <= 0)
+            continue;
+
+        // Curve boundaries and the grid points between them.
+        breakpoints.assign(1, curveStart_m);
+        for(long k = static_cast<long>(std::floor((curveStart_m - startParameter_m_) / step_)) + 1; ; ++k) {
+            double gridPoint{startParameter_m_ + k * step_};
+            if(gridPoint >= curveEnd_m - minInterval)
+                break;
+            if(gridPoint > curveStart_m + minInterval)
+                breakpoints.push_back(gridPoint);
+        }
+        breakpoints.push_back(curveEnd_m);
+
+        samples.resize(breakpoints.size());
+        try {
+            for(std::size_t j = 0; j < breakpoints.size(); ++j) {
+                double abscissaCurve_m{std::min(curve->StartParameter_m() + (breakpoints[j] - curveStart_m), curve->EndParameter_m())};
+                evaluate(curve, abscissaCurve_m, samples[j]);
+                samples[j].abscissa_m = breakpoints[j];
+
+                // Unwrap the heading w.r.t. the previous sample (also across the curves).
+                if(not first)
+                    samples[j].heading = previousHeading + std::remainder(samples[j].heading - previousHeading, 2 * M_PI);
+                previousHeading = samples[j].heading;
+                first = false;
+            }
+        } catch (std::runtime_error const& exception) {
+            throw std::runtime_error(std::string("[PathProfile::PathProfile] -> ") + exception.what());
+        }
+
+        for(std::size_t j = 0; j + 1 < samples.size(); ++j) {
+            Interval interval{samples[j]};
+            const double length{samples[j + 1].abscissa_m - samples[j].abscissa_m};
+            interval.positionSlope = (samples[j + 1].position - samples[j].position) / length;
+            interval.headingSlope = (samples[j + 1].heading - samples[j].heading) / length;
+            interval.curvatureSlope = (samples[j + 1].curvature - samples[j].curvature) / length;
+            intervals_.push_back(interval);
+        }
+
+        curveStart_m = curveEnd_m;
+    }
+
+    if(intervals_.empty())
+        throw std::runtime_error("[PathProfile::PathProfile] Input parameter error. The path has null length");
+
+    // First interval of each grid cell.
+    const std::size_t cells{static_cast<std::size_t>((endParameter_m_ - startParameter_m_) / step_) + 1};
+    cellFirstInterval_.resize(cells);
+    std::size_t interval{0};
+    for(std::size_t k = 0; k < cells; ++k) {
+        double gridPoint{startParameter_m_ + k * step_};
+        while(interval + 1 < intervals_.size() and intervals_[interval + 1].abscissa_m <= gridPoint)
+            ++interval;
+        cellFirstInterval_[k] = interval;
+    }
+}
+
+
+std::size_t PathProfile::FindInterval(double abscissa_m) const
+{
+    if(abscissa_m < startParameter_m_)
+        throw std::runtime_error("[PathProfile::FindInterval] Input parameter error. abscissa_m before startParameter_m_");
+    if(abscissa_m > endParameter_m_)
+        throw std::runtime_error("[PathProfile::FindInterval] Input parameter error. abscissa_m beyond endParameter_m_");
+
+    const std::size_t cell{std::min(static_cast<std::size_t>((abscissa_m - startParameter_m_) / step_), cellFirstInterval_.size() - 1)};
+
+    std::size_t interval{cellFirstInterval_[cell]};
+    while(interval + 1 < intervals_.size() and intervals_[interval + 1].abscissa_m <= abscissa_m)
+        ++interval;
+
+    return interval;
+}
+
+
+void PathProfile::Eval(double abscissa_m, Eigen::Vector3d& position, double& heading, double& curvature) const
+{
+    std::size_t index{0};
+
+    try {
+        index = FindInterval(abscissa_m);
+    } catch (std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[PathProfile::Eval] -> ") + exception.what());
+    }
+
+    auto const& interval = intervals_[index];
+    const double offset{abscissa_m - interval.abscissa_m};
+
+    position = interval.position + offset * interval.positionSlope;
+    heading = interval.heading + offset * interval.headingSlope;
+    curvature = interval.curvature + offset * interval.curvatureSlope;
+}
+
+
+Eigen::Vector3d PathProfile::At(double abscissa_m) const
+{
+    std::size_t index{0};
+
+    try {
+        index = FindInterval(abscissa_m);
+    } catch (std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[PathProfile::At] -> ") + exception.what());
+    }
+
+    auto const& interval = intervals_[index];
+
+    return interval.position + (abscissa_m - interval.abscissa_m) * interval.positionSlope;
+}
+
+
+double PathProfile::Heading(double abscissa_m) const
+{
+    std::size_t index{0};
+
+    try {
+        index = FindInterval(abscissa_m);
+    } catch (std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[PathProfile::Heading] -> ") + exception.what());
+    }
+
+    auto const& interval = intervals_[index];
+
+    return interval.heading + (abscissa_m - interval.abscissa_m) * interval.headingSlope;
+}
+
+
+double PathProfile::Curvature(double abscissa_m) const
+{
+    std::size_t index{0};
+
+    try {
+        index = FindInterval(abscissa_m);
+    } catch (std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[PathProfile::Curvature] -> ") + exception.what());
+    }
+
+    auto const& interval = intervals_[index];
+
+    return interval.curvature + (abscissa_m - interval.abscissa_m) * interval.curvatureSlope;
+}
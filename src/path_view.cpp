@@ -0,0 +1,167 @@
+#include "sisl_toolbox/path_view.hpp"
+
+#include "sisl_toolbox/path.hpp"
+#include "sisl_toolbox/curve.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+
+PathView::PathView(std::shared_ptr<Path> path, double startAbscissa_m, double endAbscissa_m)
+: path_{path}
+, startAbscissa_m_{startAbscissa_m}
+, endAbscissa_m_{endAbscissa_m}
+{
+    if(path_ == nullptr)
+        throw std::runtime_error("[PathView::PathView] Input parameter error. The path is null");
+    if(path_->CurvesNumber() == 0)
+        throw std::runtime_error("[PathView::PathView] Input parameter error. The path is empty");
+    if(startAbscissa_m < path_->StartParameter())
+        throw std::runtime_error("[PathView::PathView] Input parameter error. startAbscissa_m before the path start");
+    if(endAbscissa_m > path_->EndParameter())
+        throw std::runtime_error("[PathView::PathView] Input parameter error. endAbscissa_m beyond the path end");
+    if(startAbscissa_m > endAbscissa_m)
+        throw std::runtime_error("[PathView::PathView] Input parameter error. startAbscissa_m beyond endAbscissa_m");
+}
+
+
+double PathView::ToPathAbscissa(double abscissa_m, char const* method) const
+{
+    if(abscissa_m < 0)
+        throw std::runtime_error(std::string("[PathView::") + method + "] Input parameter error. abscissa_m before the view start");
+    if(abscissa_m > Length())
+        throw std::runtime_error(std::string("[PathView::") + method + "] Input parameter error. abscissa_m beyond the view end");
+
+    return std::min(startAbscissa_m_ + abscissa_m, endAbscissa_m_);
+}
+
+
+Eigen::Vector3d PathView::At(double abscissa_m) const
+{
+    const double pathAbscissa_m{ToPathAbscissa(abscissa_m, "At")};
+
+    try {
+        return path_->At(pathAbscissa_m);
+    } catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[PathView::At] -> ") + exception.what());
+    }
+}
+
+
+std::vector<Eigen::Vector3d> PathView::Derivate(int order, double abscissa_m) const
+{
+    const double pathAbscissa_m{ToPathAbscissa(abscissa_m, "Derivate")};
+
+    try {
+        return path_->Derivate(order, pathAbscissa_m);
+    } catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[PathView::Derivate] -> ") + exception.what());
+    }
+}
+
+
+double PathView::Curvature(double abscissa_m) const
+{
+    const double pathAbscissa_m{ToPathAbscissa(abscissa_m, "Curvature")};
+
+    try {
+        return path_->Curvature(pathAbscissa_m);
+    } catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[PathView::Curvature] -> ") + exception.what());
+    }
+}
+
+
+Eigen::Vector3d PathView::FindClosestPoint(Eigen::Vector3d& worldF_position, double& abscissa_m) const
+{
+    int curveId{0};
+    double abscissaCurve_m{0};
+    double distance{0};
+
+    try {
+        std::tie(curveId, abscissaCurve_m, distance) = path_->FindClosestCurveOnInterval(worldF_position, startAbscissa_m_,
+            endAbscissa_m_);
+
+        // Only degenerate (null length) curves
+        if(curveId < 0) {
+            abscissa_m = 0;
+            return path_->At(startAbscissa_m_);
+        }
+
+        abscissa_m = std::min(std::max(path_->PathAbscissa(curveId, abscissaCurve_m) - startAbscissa_m_, 0.0), Length());
+        return path_->curves_[curveId]->At(abscissaCurve_m);
+    } catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[PathView::FindClosestPoint] -> ") + exception.what());
+    }
+}
+
+
+Eigen::Vector3d PathView::FindClosestPoint(Eigen::Vector3d& worldF_position) const
+{
+    double abscissa_m{0};
+
+    return FindClosestPoint(worldF_position, abscissa_m);
+}
+
+
+double PathView::FindAbscissaClosestPoint(Eigen::Vector3d& worldF_position) const
+{
+    double abscissa_m{0};
+
+    FindClosestPoint(worldF_position, abscissa_m);
+
+    return abscissa_m;
+}
+
+
+std::shared_ptr<std::vector<Eigen::Vector3d>> PathView::Sampling(int samples) const
+{
+    auto points = std::make_shared<std::vector<Eigen::Vector3d>>();
+
+    double startCurve_m{0};
+    double endCurve_m{0};
+    int startCurveId{0};
+    int endCurveId{0};
+
+    try {
+        std::tie(startCurve_m, startCurveId) = path_->PathAbsToCurveAbs(startAbscissa_m_);
+        std::tie(endCurve_m, endCurveId) = path_->PathAbsToCurveAbs(endAbscissa_m_);
+    } catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[PathView::Sampling] -> ") + exception.what());
+    }
+
+    // Portions (curve id, start and end abscissa on the curve) of the curves in the window
+    std::vector<std::tuple<int, double, double>> portions;
+    for(int i = startCurveId; i <= endCurveId; ++i) {
+        auto const& curve = path_->curves_[i];
+        double from_m{i == startCurveId ? startCurve_m : curve->StartParameter_m()};
+        double to_m{i == endCurveId ? endCurve_m : curve->EndParameter_m()};
+        if(from_m != to_m or startCurveId == endCurveId)
+            portions.emplace_back(i, from_m, to_m);
+    }
+
+    if(portions.empty())
+        portions.emplace_back(startCurveId, startCurve_m, startCurve_m);
+
+    const int singlePortionSamples{std::max(samples / static_cast<int>(portions.size()), 2)};
+    points->reserve(singlePortionSamples * portions.size());
+
+    try {
+        for(auto const& portion: portions) {
+            auto const& curve = path_->curves_[std::get<0>(portion)];
+            const double from_m{std::get<1>(portion)};
+            const double to_m{std::get<2>(portion)};
+            for(int j = 0; j < singlePortionSamples; ++j) {
+                // The last sample exactly on the end, whatever the rounding of the step
+                const double value_m{j == singlePortionSamples - 1 ? to_m : from_m + (to_m - from_m) * j / (singlePortionSamples - 1)};
+                points->push_back(curve->At(value_m));
+            }
+        }
+    } catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[PathView::Sampling] -> ") + exception.what());
+    }
+
+    return points;
+}
@@ -0,0 +1,598 @@
+#include "sisl_toolbox/planar_path.hpp"
+
+#include "sisl_toolbox/path.hpp"
+#include "sisl_toolbox/curve.hpp"
+#include "sisl_toolbox/straight_line.hpp"
+#include "sisl_toolbox/circular_arc.hpp"
+#include "sisl_toolbox/clothoid.hpp"
+#include "sisl_toolbox/geometry.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+
+PlanarPath::PlanarPath()
+: startAbscissae_{0} {}
+
+
+PlanarPath::PlanarPath(Path const& path)
+: PlanarPath()
+{
+    const double tolerance{1e-9};
+    bool first{true};
+
+    for(auto const& curve: path.Curves()) {
+
+        if(first) {
+            elevation_ = curve->StartPoint()[2];
+            first = false;
+        }
+
+        if(curve->Length() == 0)
+            continue;
+
+        if(std::abs(curve->StartPoint()[2] - elevation_) > tolerance or std::abs(curve->EndPoint()[2] - elevation_) > tolerance)
+            throw std::runtime_error("[PlanarPath::PlanarPath] The path does not lie on a plane z = const");
+
+        Eigen::Vector2d startPoint{curve->StartPoint().head<2>()};
+
+        if(auto line = std::dynamic_pointer_cast<StraightLine>(curve)) {
+            AddLine(startPoint, line->EndPoint().head<2>());
+        }
+        else if(auto arc = std::dynamic_pointer_cast<CircularArc>(curve)) {
+            Eigen::Vector3d axis{arc->Axis().normalized()};
+            if(axis.head<2>().norm() > tolerance)
+                throw std::runtime_error("[PlanarPath::PlanarPath] Circular arc with an axis not parallel to z");
+
+            // Rotation angle around +z
+            double angle{axis[2] > 0 ? arc->Angle() : -arc->Angle()};
+            Eigen::Vector2d radial{startPoint - arc->CentrePoint().head<2>()};
+            double radius{radial.norm()};
+            double turn{angle > 0 ? 1.0 : -1.0};
+
+            AddArc(startPoint, std::atan2(turn * radial[0], -turn * radial[1]), turn / radius, std::abs(angle) * radius);
+        }
+        else if(auto clothoid = std::dynamic_pointer_cast<Clothoid>(curve)) {
+            AddClothoid(startPoint, clothoid->StartHeading(), clothoid->StartCurvature(), clothoid->EndCurvature(),
+                clothoid->Length());
+        }
+        else {
+            throw std::runtime_error("[PlanarPath::PlanarPath] Only straight lines, circular arcs and clothoids are supported, "
+                "received a " + curve->Name());
+        }
+    }
+
+    name_ = path.Name();
+}
+
+
+std::shared_ptr<Path> PlanarPath::ToPath() const
+{
+    auto path = std::make_shared<Path>();
+
+    for(auto const& segment: segments_) {
+
+        Eigen::Vector3d startPoint{segment.startPoint[0], segment.startPoint[1], elevation_};
+
+        if(segment.sharpness != 0) {
+            path->AddCurveBack(std::make_shared<Clothoid>(startPoint, segment.startHeading, segment.curvature,
+                segment.curvature + segment.sharpness * segment.length, segment.length));
+        }
+        else if(segment.curvature != 0) {
+            Eigen::Vector3d centre{startPoint + Eigen::Vector3d{-std::sin(segment.startHeading), std::cos(segment.startHeading), 0}
+                / segment.curvature};
+            path->AddCurveBack(std::make_shared<CircularArc>(segment.curvature * segment.length, Eigen::Vector3d{0, 0, 1},
+                startPoint, centre));
+        }
+        else {
+            Eigen::Vector2d endPoint{SegmentAt(segment, segment.length)};
+            path->AddCurveBack(std::make_shared<StraightLine>(startPoint, Eigen::Vector3d{endPoint[0], endPoint[1], elevation_}));
+        }
+    }
+
+    return path;
+}
+
+
+void PlanarPath::AddSegment(Segment const& segment)
+{
+    segments_.push_back(segment);
+    startAbscissae_.push_back(startAbscissae_.back() + segment.length);
+}
+
+
+void PlanarPath::AddLine(Eigen::Vector2d const& startPoint, Eigen::Vector2d const& endPoint)
+{
+    Eigen::Vector2d direction{endPoint - startPoint};
+    double length{direction.norm()};
+
+    if(length == 0)
+        return;
+
+    AddSegment(Segment{startPoint, std::atan2(direction[1], direction[0]), 0, 0, length});
+}
+
+
+void PlanarPath::AddArc(Eigen::Vector2d const& startPoint, double startHeading, double curvature, double length)
+{
+    if(curvature == 0)
+        throw std::runtime_error("[PlanarPath::AddArc] Input parameter error. curvature must not be null");
+    if(length < 0)
+        throw std::runtime_error("[PlanarPath::AddArc] Input parameter error. length must not be negative");
+
+    AddSegment(Segment{startPoint, startHeading, curvature, 0, length});
+}
+
+
+void PlanarPath::AddClothoid(Eigen::Vector2d const& startPoint, double startHeading, double startCurvature, double endCurvature,
+    double length)
+{
+    if(length <= 0)
+        throw std::runtime_error("[PlanarPath::AddClothoid] Input parameter error. length must be positive");
+
+    AddSegment(Segment{startPoint, startHeading, startCurvature, (endCurvature - startCurvature) / length, length});
+}
+
+
+std::tuple<double, int> PlanarPath::PathAbsToSegmentAbs(double abscissa_m) const
+{
+    if(segments_.empty())
+        throw std::runtime_error("[PlanarPath::PathAbsToSegmentAbs] The path is empty");
+    if(abscissa_m < 0)
+        throw std::runtime_error("[PlanarPath::PathAbsToSegmentAbs] Input parameter error. abscissa_m before the path start");
+    if(abscissa_m > Length())
+        throw std::runtime_error("[PlanarPath::PathAbsToSegmentAbs] Input parameter error. abscissa_m beyond the path end");
+
+    int segmentId{static_cast<int>(std::upper_bound(startAbscissae_.begin(), startAbscissae_.end(), abscissa_m)
+        - startAbscissae_.begin()) - 1};
+    segmentId = std::min(segmentId, SegmentsNumber() - 1);
+
+    return std::make_tuple(abscissa_m - startAbscissae_[segmentId], segmentId);
+}
+
+
+Eigen::Vector2d PlanarPath::SegmentAt(Segment const& segment, double abscissa_m)
+{
+    if(segment.sharpness != 0) {
+        double x{0};
+        double y{0};
+        Clothoid::Integrate(segment.curvature, segment.sharpness, abscissa_m, x, y);
+
+        const double cosHeading{std::cos(segment.startHeading)};
+        const double sinHeading{std::sin(segment.startHeading)};
+
+        return Eigen::Vector2d{segment.startPoint[0] + cosHeading * x - sinHeading * y,
+                               segment.startPoint[1] + sinHeading * x + cosHeading * y};
+    }
+
+    // Lines and arcs: chord of length s * sinc(k * s / 2) along the mean heading.
+    const double halfAngle{0.5 * segment.curvature * abscissa_m};
+    const double chord{std::abs(halfAngle) < 1e-8 ? abscissa_m : abscissa_m * std::sin(halfAngle) / halfAngle};
+    const double heading{segment.startHeading + halfAngle};
+
+    return segment.startPoint + chord * Eigen::Vector2d{std::cos(heading), std::sin(heading)};
+}
+
+
+Eigen::Vector2d PlanarPath::At(double abscissa_m) const
+{
+    double segmentAbscissa_m{0};
+    int segmentId{0};
+
+    try {
+        std::tie(segmentAbscissa_m, segmentId) = PathAbsToSegmentAbs(abscissa_m);
+    } catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[PlanarPath::At] -> ") + exception.what());
+    }
+
+    return SegmentAt(segments_[segmentId], segmentAbscissa_m);
+}
+
+
+double PlanarPath::Heading(double abscissa_m) const
+{
+    double segmentAbscissa_m{0};
+    int segmentId{0};
+
+    try {
+        std::tie(segmentAbscissa_m, segmentId) = PathAbsToSegmentAbs(abscissa_m);
+    } catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[PlanarPath::Heading] -> ") + exception.what());
+    }
+
+    return SegmentHeading(segments_[segmentId], segmentAbscissa_m);
+}
+
+
+double PlanarPath::Curvature(double abscissa_m) const
+{
+    double segmentAbscissa_m{0};
+    int segmentId{0};
+
+    try {
+        std::tie(segmentAbscissa_m, segmentId) = PathAbsToSegmentAbs(abscissa_m);
+    } catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[PlanarPath::Curvature] -> ") + exception.what());
+    }
+
+    return segments_[segmentId].curvature + segments_[segmentId].sharpness * segmentAbscissa_m;
+}
+
+
+void PlanarPath::EvalTangentFrame(double abscissa_m, Eigen::Vector2d& tangent, Eigen::Vector2d& normal) const
+{
+    double heading{0};
+
+    try {
+        heading = Heading(abscissa_m);
+    } catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[PlanarPath::EvalTangentFrame] -> ") + exception.what());
+    }
+
+    tangent = Eigen::Vector2d{std::cos(heading), std::sin(heading)};
+    normal = Eigen::Vector2d{-tangent[1], tangent[0]};
+}
+
+
+std::shared_ptr<std::vector<Eigen::Vector2d>> PlanarPath::Sampling(int samples) const
+{
+    auto points = std::make_shared<std::vector<Eigen::Vector2d>>();
+
+    if(segments_.empty() or samples < 2)
+        return points;
+
+    points->reserve(samples);
+
+    // Samples are sorted: the segment index only increases.
+    int segmentId{0};
+    for(int k = 0; k < samples; ++k) {
+        double abscissa_m{Length() * k / (samples - 1)};
+        while(segmentId < SegmentsNumber() - 1 and abscissa_m > startAbscissae_[segmentId + 1])
+            ++segmentId;
+        points->push_back(SegmentAt(segments_[segmentId], abscissa_m - startAbscissae_[segmentId]));
+    }
+
+    return points;
+}
+
+
+double PlanarPath::ArcAbscissa(Segment const& arc, Eigen::Vector2d const& point, double tolerance)
+{
+    const double radius{1.0 / std::abs(arc.curvature)};
+    const double turn{arc.curvature > 0 ? 1.0 : -1.0};
+    const Eigen::Vector2d centre{arc.startPoint + Eigen::Vector2d{-std::sin(arc.startHeading), std::cos(arc.startHeading)}
+        / arc.curvature};
+
+    const Eigen::Vector2d startRadial{arc.startPoint - centre};
+    const Eigen::Vector2d radial{point - centre};
+
+    // Swept angle from the start, in the direction of travel, in [0, 2pi).
+    double angle{turn * std::atan2(startRadial[0] * radial[1] - startRadial[1] * radial[0], startRadial.dot(radial))};
+    if(angle < 0)
+        angle += 2 * M_PI;
+
+    const double abscissa_m{angle * radius};
+
+    if(abscissa_m <= arc.length + tolerance)
+        return std::min(abscissa_m, arc.length);
+    if(2 * M_PI * radius - abscissa_m <= tolerance)
+        return 0;
+
+    return -1;
+}
+
+
+std::tuple<double, double> PlanarPath::SegmentClosestPoint(Segment const& segment, Eigen::Vector2d const& position)
+{
+    // Straight line: clamped projection.
+    if(segment.curvature == 0 and segment.sharpness == 0) {
+        Eigen::Vector2d direction{std::cos(segment.startHeading), std::sin(segment.startHeading)};
+        double abscissa_m{std::min(std::max((position - segment.startPoint).dot(direction), 0.0), segment.length)};
+        return std::make_tuple(abscissa_m, (segment.startPoint + abscissa_m * direction - position).norm());
+    }
+
+    // End points are always candidates.
+    double bestAbscissa_m{0};
+    double bestDistance{(segment.startPoint - position).norm()};
+    double endDistance{(SegmentAt(segment, segment.length) - position).norm()};
+    if(endDistance < bestDistance) {
+        bestDistance = endDistance;
+        bestAbscissa_m = segment.length;
+    }
+
+    // Circular arc: radial projection.
+    if(segment.sharpness == 0) {
+        double abscissa_m{ArcAbscissa(segment, position, 0)};
+        if(abscissa_m >= 0) {
+            double distance{(SegmentAt(segment, abscissa_m) - position).norm()};
+            if(distance < bestDistance) {
+                bestDistance = distance;
+                bestAbscissa_m = abscissa_m;
+            }
+        }
+        return std::make_tuple(bestAbscissa_m, bestDistance);
+    }
+
+    // Clothoid: coarse sampling, then Newton iteration on the tangent orthogonality.
+    const double maxCurvature{std::max(std::abs(segment.curvature), std::abs(segment.curvature + segment.sharpness * segment.length))};
+    const int samples{std::min(256, std::max(16, static_cast<int>(8 * segment.length * maxCurvature)))};
+
+    double abscissa_m{0};
+    double minDistance{std::numeric_limits<double>::max()};
+    for(int k = 0; k <= samples; ++k) {
+        double sample_m{segment.length * k / samples};
+        double distance{(SegmentAt(segment, sample_m) - position).norm()};
+        if(distance < minDistance) {
+            minDistance = distance;
+            abscissa_m = sample_m;
+        }
+    }
+
+    for(int iteration = 0; iteration < 8; ++iteration) {
+        double heading{SegmentHeading(segment, abscissa_m)};
+        Eigen::Vector2d tangent{std::cos(heading), std::sin(heading)};
+        Eigen::Vector2d normal{-tangent[1], tangent[0]};
+        Eigen::Vector2d difference{SegmentAt(segment, abscissa_m) - position};
+
+        double function{tangent.dot(difference)};
+        double derivative{1 + (segment.curvature + segment.sharpness * abscissa_m) * normal.dot(difference)};
+        if(derivative <= 0)
+            break;
+
+        double step{function / derivative};
+        abscissa_m = std::min(std::max(abscissa_m - step, 0.0), segment.length);
+        if(std::abs(step) < 1e-12)
+            break;
+    }
+
+    double distance{(SegmentAt(segment, abscissa_m) - position).norm()};
+    if(distance < bestDistance) {
+        bestDistance = distance;
+        bestAbscissa_m = abscissa_m;
+    }
+
+    return std::make_tuple(bestAbscissa_m, bestDistance);
+}
+
+
+Eigen::Vector2d PlanarPath::FindClosestPoint(Eigen::Vector2d const& position, int& segmentId, double& abscissa_m) const
+{
+    if(segments_.empty())
+        throw std::runtime_error("[PlanarPath::FindClosestPoint] The path is empty");
+
+    double minDistance{std::numeric_limits<double>::max()};
+    double segmentAbscissa_m{0};
+    double distance{0};
+    double bestSegmentAbscissa_m{0};
+
+    for(int i = 0; i < SegmentsNumber(); ++i) {
+        std::tie(segmentAbscissa_m, distance) = SegmentClosestPoint(segments_[i], position);
+        if(distance < minDistance) {
+            minDistance = distance;
+            segmentId = i;
+            bestSegmentAbscissa_m = segmentAbscissa_m;
+        }
+    }
+
+    abscissa_m = startAbscissae_[segmentId] + bestSegmentAbscissa_m;
+
+    return SegmentAt(segments_[segmentId], bestSegmentAbscissa_m);
+}
+
+
+double PlanarPath::FindAbscissaClosestPoint(Eigen::Vector2d const& position) const
+{
+    int segmentId{0};
+    double abscissa_m{0};
+
+    try {
+        FindClosestPoint(position, segmentId, abscissa_m);
+    } catch(std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[PlanarPath::FindAbscissaClosestPoint] -> ") + exception.what());
+    }
+
+    return abscissa_m;
+}
+
+
+std::vector<std::tuple<double, double>> PlanarPath::SegmentIntersections(Segment const& first, Segment const& second)
+{
+    const double tolerance{1e-9};
+    std::vector<std::tuple<double, double>> intersections;
+
+    /***************** Clothoids: intersections of the chords, refined on the exact curves *****************/
+
+    if(first.sharpness != 0 or second.sharpness != 0) {
+
+        // Chords with a heading change of at most 0.05 rad (the lines and the arcs are kept as they are).
+        auto chords = [](Segment const& segment) {
+            std::vector<std::tuple<Segment, double, double>> pieces; // Chord, start and end abscissa on the segment
+            if(segment.sharpness == 0) {
+                pieces.emplace_back(segment, 0.0, segment.length);
+                return pieces;
+            }
+            double turning{std::abs(segment.curvature) * segment.length + 0.5 * std::abs(segment.sharpness) * segment.length * segment.length};
+            int number{std::max(4, static_cast<int>(std::ceil(turning / 0.05)))};
+            for(int k = 0; k < number; ++k) {
+                double start_m{segment.length * k / number};
+                double end_m{segment.length * (k + 1) / number};
+                Eigen::Vector2d startPoint{SegmentAt(segment, start_m)};
+                Eigen::Vector2d chord{SegmentAt(segment, end_m) - startPoint};
+                pieces.emplace_back(Segment{startPoint, std::atan2(chord[1], chord[0]), 0, 0, chord.norm()}, start_m, end_m);
+            }
+            return pieces;
+        };
+
+        auto firstPieces = chords(first);
+        auto secondPieces = chords(second);
+
+        for(auto const& firstPiece: firstPieces) {
+            for(auto const& secondPiece: secondPieces) {
+
+                Segment const& firstChord{std::get<0>(firstPiece)};
+                Segment const& secondChord{std::get<0>(secondPiece)};
+
+                for(auto const& candidate: SegmentIntersections(firstChord, secondChord)) {
+
+                    // Initial guess: the chord abscissae mapped on the segments.
+                    double s1{first.sharpness == 0 ? std::get<0>(candidate) : std::get<1>(firstPiece)
+                        + std::get<0>(candidate) / firstChord.length * (std::get<2>(firstPiece) - std::get<1>(firstPiece))};
+                    double s2{second.sharpness == 0 ? std::get<1>(candidate) : std::get<1>(secondPiece)
+                        + std::get<1>(candidate) / secondChord.length * (std::get<2>(secondPiece) - std::get<1>(secondPiece))};
+
+                    // Newton on P1(s1) - P2(s2) = 0.
+                    Eigen::Vector2d residual{SegmentAt(first, s1) - SegmentAt(second, s2)};
+                    for(int iteration = 0; iteration < 10 and residual.norm() > 1e-12; ++iteration) {
+                        double heading1{SegmentHeading(first, s1)};
+                        double heading2{SegmentHeading(second, s2)};
+                        Eigen::Matrix2d jacobian;
+                        jacobian << std::cos(heading1), -std::cos(heading2),
+                                    std::sin(heading1), -std::sin(heading2);
+                        if(std::abs(jacobian.determinant()) < 1e-12)
+                            break;
+                        Eigen::Vector2d step{jacobian.inverse() * residual};
+                        s1 = std::min(std::max(s1 - step[0], 0.0), first.length);
+                        s2 = std::min(std::max(s2 - step[1], 0.0), second.length);
+                        residual = SegmentAt(first, s1) - SegmentAt(second, s2);
+                    }
+
+                    if(residual.norm() < tolerance)
+                        intersections.emplace_back(s1, s2);
+                }
+            }
+        }
+
+        return intersections;
+    }
+
+    /***************** Lines and arcs: closed form *****************/
+
+    const bool firstLine{first.curvature == 0};
+    const bool secondLine{second.curvature == 0};
+
+    if(firstLine and secondLine) {
+        Eigen::Vector2d d1{std::cos(first.startHeading), std::sin(first.startHeading)};
+        Eigen::Vector2d d2{std::cos(second.startHeading), std::sin(second.startHeading)};
+        Eigen::Vector2d offset{second.startPoint - first.startPoint};
+        double cross{d1[0] * d2[1] - d1[1] * d2[0]};
+
+        // Parallel lines (overlaps are not reported).
+        if(std::abs(cross) < 1e-12)
+            return intersections;
+
+        double s1{(offset[0] * d2[1] - offset[1] * d2[0]) / cross};
+        double s2{(offset[0] * d1[1] - offset[1] * d1[0]) / cross};
+
+        // Exact crossing test, the tolerance only adds the near misses.
+        const bool crossing{Geometry::SegmentsIntersect(first.startPoint, SegmentAt(first, first.length), second.startPoint, 
+            SegmentAt(second, second.length))};
+
+        if(crossing or (s1 >= -tolerance and s1 <= first.length + tolerance and s2 >= -tolerance and s2 <= second.length + tolerance))
+            intersections.emplace_back(std::min(std::max(s1, 0.0), first.length), std::min(std::max(s2, 0.0), second.length));
+
+        return intersections;
+    }
+
+    if(firstLine != secondLine) {
+        Segment const& line{firstLine ? first : second};
+        Segment const& arc{firstLine ? second : first};
+
+        Eigen::Vector2d direction{std::cos(line.startHeading), std::sin(line.startHeading)};
+        Eigen::Vector2d centre{arc.startPoint + Eigen::Vector2d{-std::sin(arc.startHeading), std::cos(arc.startHeading)} / arc.curvature};
+        Eigen::Vector2d relative{line.startPoint - centre};
+        double radius{1.0 / std::abs(arc.curvature)};
+
+        // |relative + t * direction| = radius
+        double b{direction.dot(relative)};
+        double discriminant{b * b - (relative.squaredNorm() - radius * radius)};
+        if(discriminant < 0)
+            return intersections;
+
+        double root{std::sqrt(discriminant)};
+        for(double t: {-b - root, -b + root}) {
+            if(t < -tolerance or t > line.length + tolerance)
+                continue;
+            t = std::min(std::max(t, 0.0), line.length);
+            double arcAbscissa_m{ArcAbscissa(arc, line.startPoint + t * direction, tolerance)};
+            if(arcAbscissa_m < 0)
+                continue;
+            if(firstLine)
+                intersections.emplace_back(t, arcAbscissa_m);
+            else
+                intersections.emplace_back(arcAbscissa_m, t);
+            if(root == 0)
+                break;
+        }
+
+        return intersections;
+    }
+
+    // Arc - arc: circle - circle intersection.
+    Eigen::Vector2d c1{first.startPoint + Eigen::Vector2d{-std::sin(first.startHeading), std::cos(first.startHeading)} / first.curvature};
+    Eigen::Vector2d c2{second.startPoint + Eigen::Vector2d{-std::sin(second.startHeading), std::cos(second.startHeading)} / second.curvature};
+    double r1{1.0 / std::abs(first.curvature)};
+    double r2{1.0 / std::abs(second.curvature)};
+    double distance{(c2 - c1).norm()};
+
+    if(distance == 0 or distance > r1 + r2 + tolerance or distance < std::abs(r1 - r2) - tolerance)
+        return intersections;
+
+    double a{(r1 * r1 - r2 * r2 + distance * distance) / (2 * distance)};
+    double h{std::sqrt(std::max(0.0, r1 * r1 - a * a))};
+    Eigen::Vector2d axis{(c2 - c1) / distance};
+    Eigen::Vector2d base{c1 + a * axis};
+    Eigen::Vector2d perpendicular{-axis[1], axis[0]};
+
+    for(double sign: {-1.0, 1.0}) {
+        Eigen::Vector2d point{base + sign * h * perpendicular};
+        double s1{ArcAbscissa(first, point, tolerance)};
+        double s2{ArcAbscissa(second, point, tolerance)};
+        if(s1 >= 0 and s2 >= 0)
+            intersections.emplace_back(s1, s2);
+        if(h == 0)
+            break;
+    }
+
+    return intersections;
+}
+
+
+std::vector<Eigen::Vector2d> PlanarPath::Intersection(PlanarPath const& otherPath) const
+{
+    std::vector<Eigen::Vector2d> intersections;
+
+    // Every point of a segment is within half of its length from its middle point: cheap rejection test.
+    auto middles = [](PlanarPath const& path) {
+        std::vector<Eigen::Vector2d> points;
+        points.reserve(path.segments_.size());
+        for(auto const& segment: path.segments_)
+            points.push_back(SegmentAt(segment, 0.5 * segment.length));
+        return points;
+    };
+
+    auto firstMiddles = middles(*this);
+    auto secondMiddles = middles(otherPath);
+
+    for(int i = 0; i < SegmentsNumber(); ++i) {
+        for(int j = 0; j < otherPath.SegmentsNumber(); ++j) {
+
+            Segment const& first{segments_[i]};
+            Segment const& second{otherPath.segments_[j]};
+
+            if((firstMiddles[i] - secondMiddles[j]).norm() > 0.5 * (first.length + second.length) + 1e-9)
+                continue;
+
+            for(auto const& abscissae: SegmentIntersections(first, second)) {
+                Eigen::Vector2d point{SegmentAt(first, std::get<0>(abscissae))};
+                bool duplicate{false};
+                for(auto const& intersection: intersections)
+                    duplicate = duplicate or (intersection - point).norm() < 1e-6;
+                if(not duplicate)
+                    intersections.push_back(point);
+            }
+        }
+    }
+
+    return intersections;
+}
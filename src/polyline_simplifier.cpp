@@ -0,0 +1,230 @@
+#include "sisl_toolbox/polyline_simplifier.hpp"
+
+#include "sisl_toolbox/path.hpp"
+#include "sisl_toolbox/curve.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <tuple>
+#include <utility>
+
+
+double PolylineSimplifier::DistanceFromSegment(Eigen::Vector3d const& point, Eigen::Vector3d const& start, Eigen::Vector3d const& end)
+{
+    Eigen::Vector3d segment{end - start};
+    double squaredLength{segment.squaredNorm()};
+
+    if(squaredLength == 0)
+        return (point - start).norm();
+
+    double ratio{std::max(0.0, std::min(1.0, (point - start).dot(segment) / squaredLength))};
+
+    return (start + ratio * segment - point).norm();
+}
+
+
+std::vector<std::size_t> PolylineSimplifier::Chunks(std::size_t pointsNumber, std::vector<std::size_t> const& breaks)
+{
+    std::vector<std::size_t> chunks{0};
+
+    std::vector<std::size_t> sortedBreaks(breaks);
+    std::sort(sortedBreaks.begin(), sortedBreaks.end());
+
+    for(auto index: sortedBreaks) {
+        if(index > chunks.back() and index < pointsNumber - 1)
+            chunks.push_back(index);
+    }
+    chunks.push_back(pointsNumber - 1);
+
+    return chunks;
+}
+
+
+void PolylineSimplifier::DouglasPeuckerChunk(std::vector<Eigen::Vector3d> const& points, std::size_t first, std::size_t last, 
+    double tolerance, std::vector<char>& keep)
+{
+    keep[first] = 1;
+
+    std::vector<std::pair<std::size_t, std::size_t>> stack{{first, last}};
+
+    while(not stack.empty()) {
+
+        std::size_t start{stack.back().first};
+        std::size_t end{stack.back().second};
+        stack.pop_back();
+
+        double maxDistance{0};
+        std::size_t farthest{start};
+
+        for(std::size_t i = start + 1; i < end; ++i) {
+            double distance{DistanceFromSegment(points[i], points[start], points[end])};
+            if(distance > maxDistance) {
+                maxDistance = distance;
+                farthest = i;
+            }
+        }
+
+        if(maxDistance > tolerance) {
+            keep[farthest] = 1;
+            stack.emplace_back(start, farthest);
+            stack.emplace_back(farthest, end);
+        }
+    }
+}
+
+
+void PolylineSimplifier::VisvalingamChunk(std::vector<Eigen::Vector3d> const& points, std::size_t first, std::size_t last, 
+    double areaTolerance, std::vector<char>& keep)
+{
+    const std::size_t size{last - first + 1};
+
+    // Doubly linked list over the chunk (local indices).
+    std::vector<std::size_t> previous(size);
+    std::vector<std::size_t> next(size);
+    std::vector<double> areas(size, 0);
+
+    auto area = [&](std::size_t i) {
+        return 0.5 * (points[first + i] - points[first + previous[i]]).cross(points[first + next[i]] - points[first + previous[i]]).norm();
+    };
+
+    using Entry = std::pair<double, std::size_t>;
+    std::vector<Entry> entries;
+    entries.reserve(size);
+
+    for(std::size_t i = 0; i < size; ++i) {
+        previous[i] = (i == 0) ? 0 : i - 1;
+        next[i] = (i + 1 == size) ? i : i + 1;
+    }
+    for(std::size_t i = 1; i + 1 < size; ++i) {
+        areas[i] = area(i);
+        entries.emplace_back(areas[i], i);
+    }
+
+    // Heapify in linear time.
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap{std::greater<Entry>{}, std::move(entries)};
+
+    std::vector<char> removed(size, 0);
+
+    while(not heap.empty()) {
+
+        double currentArea{heap.top().first};
+        std::size_t i{heap.top().second};
+        heap.pop();
+
+        // Stale entry: the point has been removed or its area updated.
+        if(removed[i] or currentArea != areas[i])
+            continue;
+        if(currentArea >= areaTolerance)
+            break;
+
+        removed[i] = 1;
+        std::size_t before{previous[i]};
+        std::size_t after{next[i]};
+        next[before] = after;
+        previous[after] = before;
+
+        // The neighbours inherit at least the removed area, so that the removal order stays monotonic.
+        for(auto neighbour: {before, after}) {
+            if(neighbour == 0 or neighbour + 1 == size)
+                continue;
+            areas[neighbour] = std::max(area(neighbour), currentArea);
+            heap.emplace(areas[neighbour], neighbour);
+        }
+    }
+
+    for(std::size_t i = 0; i + 1 < size; ++i) {
+        if(not removed[i])
+            keep[first + i] = 1;
+    }
+}
+
+
+std::shared_ptr<std::vector<Eigen::Vector3d>> PolylineSimplifier::DouglasPeucker(std::shared_ptr<std::vector<Eigen::Vector3d>> points, 
+    double tolerance, std::vector<std::size_t> const& breaks)
+{
+    auto simplified = std::make_shared<std::vector<Eigen::Vector3d>>();
+
+    if(points->size() < 3) {
+        *simplified = *points;
+        return simplified;
+    }
+
+    auto chunks = Chunks(points->size(), breaks);
+    std::vector<char> keep(points->size(), 0);
+    const int chunksNumber{static_cast<int>(chunks.size()) - 1};
+
+    // The chunks write disjoint ranges of keep (the last point of each chunk is marked by the next one).
+    #pragma omp parallel for schedule(dynamic)
+    for(int c = 0; c < chunksNumber; ++c) {
+        DouglasPeuckerChunk(*points, chunks[c], chunks[c + 1], tolerance, keep);
+    }
+    keep.back() = 1;
+
+    for(std::size_t i = 0; i < points->size(); ++i) {
+        if(keep[i])
+            simplified->push_back((*points)[i]);
+    }
+
+    return simplified;
+}
+
+
+std::shared_ptr<std::vector<Eigen::Vector3d>> PolylineSimplifier::Visvalingam(std::shared_ptr<std::vector<Eigen::Vector3d>> points, 
+    double areaTolerance, std::vector<std::size_t> const& breaks)
+{
+    auto simplified = std::make_shared<std::vector<Eigen::Vector3d>>();
+
+    if(points->size() < 3) {
+        *simplified = *points;
+        return simplified;
+    }
+
+    auto chunks = Chunks(points->size(), breaks);
+    std::vector<char> keep(points->size(), 0);
+    const int chunksNumber{static_cast<int>(chunks.size()) - 1};
+
+    #pragma omp parallel for schedule(dynamic)
+    for(int c = 0; c < chunksNumber; ++c) {
+        VisvalingamChunk(*points, chunks[c], chunks[c + 1], areaTolerance, keep);
+    }
+    keep.back() = 1;
+
+    for(std::size_t i = 0; i < points->size(); ++i) {
+        if(keep[i])
+            simplified->push_back((*points)[i]);
+    }
+
+    return simplified;
+}
+
+
+std::shared_ptr<std::vector<Eigen::Vector3d>> PolylineSimplifier::SimplifiedSampling(std::shared_ptr<Path> path, int samples, 
+    double tolerance)
+{
+    auto simplified = std::make_shared<std::vector<Eigen::Vector3d>>();
+
+    const int curvesNumber{path->CurvesNumber()};
+    if(curvesNumber == 0)
+        return simplified;
+
+    const int singleCurveSamples{samples / curvesNumber};
+    auto const& curves = path->Curves();
+    std::vector<std::shared_ptr<std::vector<Eigen::Vector3d>>> curvePoints(curvesNumber);
+
+    #pragma omp parallel for schedule(dynamic)
+    for(int i = 0; i < curvesNumber; ++i) {
+        auto sampled = curves[i]->Sampling(singleCurveSamples);
+        curvePoints[i] = DouglasPeucker(sampled, tolerance);
+    }
+
+    for(auto const& points: curvePoints) {
+        for(auto const& point: *points) {
+            // Skip the junction point repeated by the next curve.
+            if(simplified->empty() or simplified->back() != point)
+                simplified->push_back(point);
+        }
+    }
+
+    return simplified;
+}
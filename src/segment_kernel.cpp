@@ -0,0 +1,308 @@
+#include "sisl_toolbox/segment_kernel.hpp"
+
+#include "sisl_toolbox/straight_line.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+
+SegmentKernel::SegmentKernel(std::vector<std::shared_ptr<Curve>> const& curves)
+: firstSegment_{0}
+, otherCurvesBefore_{0}
+, curveStartAbscissa_{0}
+{
+    Splice(curves, 0, 0, static_cast<int>(curves.size()));
+}
+
+
+void SegmentKernel::AppendCurve(std::shared_ptr<Curve> const& curve, int curveId)
+{
+    firstSegment_.push_back(firstSegment_.back());
+    otherCurvesBefore_.push_back(otherCurvesBefore_.back());
+    curveStartAbscissa_.push_back(curveStartAbscissa_.back() + curve->Length());
+
+    if(std::dynamic_pointer_cast<StraightLine>(curve) == nullptr) {
+        ++otherCurvesBefore_.back();
+        return;
+    }
+    if(curve->Length() == 0)
+        return;
+
+    Eigen::Vector3d direction{curve->EndPoint() - curve->StartPoint()};
+    double squaredLength{direction.squaredNorm()};
+    if(squaredLength == 0)
+        return;
+
+    startX_.push_back(curve->StartPoint()[0]);
+    startY_.push_back(curve->StartPoint()[1]);
+    startZ_.push_back(curve->StartPoint()[2]);
+    directionX_.push_back(direction[0]);
+    directionY_.push_back(direction[1]);
+    directionZ_.push_back(direction[2]);
+    inverseSquaredLength_.push_back(1.0 / squaredLength);
+    length_.push_back(curve->Length());
+    curveId_.push_back(curveId);
+
+    // The entry of the next curve counts this segment.
+    ++firstSegment_.back();
+}
+
+
+template <typename T>
+void SegmentKernel::SpliceArray(std::vector<T>& target, int first, int erased, std::vector<T> const& source, int sourceFirst)
+{
+    const int common{std::min(erased, static_cast<int>(source.size()) - sourceFirst)};
+
+    std::copy(source.begin() + sourceFirst, source.begin() + sourceFirst + common, target.begin() + first);
+    if(erased > common)
+        target.erase(target.begin() + first + common, target.begin() + first + erased);
+    else
+        target.insert(target.begin() + first + common, source.begin() + sourceFirst + common, source.end());
+}
+
+
+void SegmentKernel::Splice(std::vector<std::shared_ptr<Curve>> const& curves, int firstCurve, int erasedCurves, int insertedCurves)
+{
+    if(firstCurve < 0 or erasedCurves < 0 or firstCurve + erasedCurves > CurvesNumber() or insertedCurves < 0 
+        or firstCurve + insertedCurves > static_cast<int>(curves.size()))
+        throw std::runtime_error("[SegmentKernel::Splice] Input parameter error. Curves range out of bound");
+
+    const int lastErased{firstCurve + erasedCurves};
+    const int firstSegment{firstSegment_[firstCurve]};
+    const int erasedSegments{firstSegment_[lastErased] - firstSegment};
+    const int erasedOther{otherCurvesBefore_[lastErased] - otherCurvesBefore_[firstCurve]};
+    const double erasedLength{curveStartAbscissa_[lastErased] - curveStartAbscissa_[firstCurve]};
+
+    // Segments and bookkeeping of the inserted curves, starting from the state before firstCurve.
+    SegmentKernel inserted;
+    inserted.firstSegment_ = {firstSegment};
+    inserted.otherCurvesBefore_ = {otherCurvesBefore_[firstCurve]};
+    inserted.curveStartAbscissa_ = {curveStartAbscissa_[firstCurve]};
+    for(int i = firstCurve; i < firstCurve + insertedCurves; ++i)
+        inserted.AppendCurve(curves[i], i);
+
+    const int insertedSegments{inserted.firstSegment_.back() - firstSegment};
+    const int deltaSegments{insertedSegments - erasedSegments};
+    const int deltaOther{inserted.otherCurvesBefore_.back() - otherCurvesBefore_[firstCurve] - erasedOther};
+    const double deltaLength{inserted.curveStartAbscissa_.back() - curveStartAbscissa_[firstCurve] - erasedLength};
+
+    // Segments: the untouched ones are moved, only the curve ids after the splice change.
+    SpliceArray(startX_, firstSegment, erasedSegments, inserted.startX_, 0);
+    SpliceArray(startY_, firstSegment, erasedSegments, inserted.startY_, 0);
+    SpliceArray(startZ_, firstSegment, erasedSegments, inserted.startZ_, 0);
+    SpliceArray(directionX_, firstSegment, erasedSegments, inserted.directionX_, 0);
+    SpliceArray(directionY_, firstSegment, erasedSegments, inserted.directionY_, 0);
+    SpliceArray(directionZ_, firstSegment, erasedSegments, inserted.directionZ_, 0);
+    SpliceArray(inverseSquaredLength_, firstSegment, erasedSegments, inserted.inverseSquaredLength_, 0);
+    SpliceArray(length_, firstSegment, erasedSegments, inserted.length_, 0);
+    SpliceArray(curveId_, firstSegment, erasedSegments, inserted.curveId_, 0);
+
+    for(int i = firstSegment + insertedSegments; i < SegmentsNumber(); ++i)
+        curveId_[i] += insertedCurves - erasedCurves;
+
+    // Curves bookkeeping: the entries of the inserted curves replace the erased ones (the first entry is unchanged), the
+    // following ones are shifted.
+    SpliceArray(firstSegment_, firstCurve + 1, erasedCurves, inserted.firstSegment_, 1);
+    SpliceArray(otherCurvesBefore_, firstCurve + 1, erasedCurves, inserted.otherCurvesBefore_, 1);
+    SpliceArray(curveStartAbscissa_, firstCurve + 1, erasedCurves, inserted.curveStartAbscissa_, 1);
+
+    for(std::size_t i = firstCurve + insertedCurves + 1; i < firstSegment_.size(); ++i) {
+        firstSegment_[i] += deltaSegments;
+        otherCurvesBefore_[i] += deltaOther;
+        curveStartAbscissa_[i] += deltaLength;
+    }
+}
+
+
+std::tuple<int, double, double> SegmentKernel::FindClosestSegment(Eigen::Vector3d const& worldF_position, int firstSegment,
+    int lastSegment) const
+{
+    firstSegment = std::max(firstSegment, 0);
+    lastSegment = std::min(lastSegment, SegmentsNumber());
+
+    if(firstSegment >= lastSegment)
+        return std::make_tuple(-1, 0.0, std::numeric_limits<double>::max());
+
+    double const px{worldF_position[0]};
+    double const py{worldF_position[1]};
+    double const pz{worldF_position[2]};
+
+    double minSquaredDistance{std::numeric_limits<double>::max()};
+    int segmentId{-1};
+    int i{firstSegment};
+
+#if defined(__AVX2__)
+
+    // 4 segments per iteration. The segment ids are carried as doubles (exact up to 2^53) to blend them with the distances.
+    if(lastSegment - i >= 4) {
+
+        __m256d const vpx{_mm256_set1_pd(px)};
+        __m256d const vpy{_mm256_set1_pd(py)};
+        __m256d const vpz{_mm256_set1_pd(pz)};
+        __m256d const zero{_mm256_setzero_pd()};
+        __m256d const one{_mm256_set1_pd(1.0)};
+        __m256d const four{_mm256_set1_pd(4.0)};
+
+        __m256d minDistance{_mm256_set1_pd(std::numeric_limits<double>::max())};
+        __m256d minId{_mm256_set1_pd(-1.0)};
+        __m256d id{_mm256_setr_pd(i, i + 1, i + 2, i + 3)};
+
+        for(; i + 4 <= lastSegment; i += 4) {
+            __m256d const wx{_mm256_sub_pd(vpx, _mm256_loadu_pd(&startX_[i]))};
+            __m256d const wy{_mm256_sub_pd(vpy, _mm256_loadu_pd(&startY_[i]))};
+            __m256d const wz{_mm256_sub_pd(vpz, _mm256_loadu_pd(&startZ_[i]))};
+            __m256d const dx{_mm256_loadu_pd(&directionX_[i])};
+            __m256d const dy{_mm256_loadu_pd(&directionY_[i])};
+            __m256d const dz{_mm256_loadu_pd(&directionZ_[i])};
+
+#if defined(__FMA__)
+            __m256d t{_mm256_fmadd_pd(wz, dz, _mm256_fmadd_pd(wy, dy, _mm256_mul_pd(wx, dx)))};
+#else
+            __m256d t{_mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(wx, dx), _mm256_mul_pd(wy, dy)), _mm256_mul_pd(wz, dz))};
+#endif
+            t = _mm256_mul_pd(t, _mm256_loadu_pd(&inverseSquaredLength_[i]));
+            t = _mm256_min_pd(_mm256_max_pd(t, zero), one);
+
+#if defined(__FMA__)
+            __m256d const ex{_mm256_fnmadd_pd(t, dx, wx)};
+            __m256d const ey{_mm256_fnmadd_pd(t, dy, wy)};
+            __m256d const ez{_mm256_fnmadd_pd(t, dz, wz)};
+            __m256d const distance{_mm256_fmadd_pd(ez, ez, _mm256_fmadd_pd(ey, ey, _mm256_mul_pd(ex, ex)))};
+#else
+            __m256d const ex{_mm256_sub_pd(wx, _mm256_mul_pd(t, dx))};
+            __m256d const ey{_mm256_sub_pd(wy, _mm256_mul_pd(t, dy))};
+            __m256d const ez{_mm256_sub_pd(wz, _mm256_mul_pd(t, dz))};
+            __m256d const distance{_mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(ex, ex), _mm256_mul_pd(ey, ey)),
+                _mm256_mul_pd(ez, ez))};
+#endif
+            __m256d const closer{_mm256_cmp_pd(distance, minDistance, _CMP_LT_OQ)};
+            minDistance = _mm256_blendv_pd(minDistance, distance, closer);
+            minId = _mm256_blendv_pd(minId, id, closer);
+            id = _mm256_add_pd(id, four);
+        }
+
+        alignas(32) double laneDistance[4];
+        alignas(32) double laneId[4];
+        _mm256_store_pd(laneDistance, minDistance);
+        _mm256_store_pd(laneId, minId);
+
+        for(int lane = 0; lane < 4; ++lane) {
+            int const laneSegment{static_cast<int>(laneId[lane])};
+            if(laneSegment >= 0 and (laneDistance[lane] < minSquaredDistance or
+                (laneDistance[lane] == minSquaredDistance and laneSegment < segmentId))) {
+                minSquaredDistance = laneDistance[lane];
+                segmentId = laneSegment;
+            }
+        }
+    }
+
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+
+    // 2 segments per iteration, same scheme of the AVX2 version.
+    if(lastSegment - i >= 2) {
+
+        float64x2_t const vpx{vdupq_n_f64(px)};
+        float64x2_t const vpy{vdupq_n_f64(py)};
+        float64x2_t const vpz{vdupq_n_f64(pz)};
+        float64x2_t const zero{vdupq_n_f64(0.0)};
+        float64x2_t const one{vdupq_n_f64(1.0)};
+        float64x2_t const two{vdupq_n_f64(2.0)};
+
+        float64x2_t minDistance{vdupq_n_f64(std::numeric_limits<double>::max())};
+        float64x2_t minId{vdupq_n_f64(-1.0)};
+        double const firstIds[2]{static_cast<double>(i), static_cast<double>(i + 1)};
+        float64x2_t id{vld1q_f64(firstIds)};
+
+        for(; i + 2 <= lastSegment; i += 2) {
+            float64x2_t const wx{vsubq_f64(vpx, vld1q_f64(&startX_[i]))};
+            float64x2_t const wy{vsubq_f64(vpy, vld1q_f64(&startY_[i]))};
+            float64x2_t const wz{vsubq_f64(vpz, vld1q_f64(&startZ_[i]))};
+            float64x2_t const dx{vld1q_f64(&directionX_[i])};
+            float64x2_t const dy{vld1q_f64(&directionY_[i])};
+            float64x2_t const dz{vld1q_f64(&directionZ_[i])};
+
+            float64x2_t t{vfmaq_f64(vfmaq_f64(vmulq_f64(wx, dx), wy, dy), wz, dz)};
+            t = vmulq_f64(t, vld1q_f64(&inverseSquaredLength_[i]));
+            t = vminq_f64(vmaxq_f64(t, zero), one);
+
+            float64x2_t const ex{vfmsq_f64(wx, t, dx)};
+            float64x2_t const ey{vfmsq_f64(wy, t, dy)};
+            float64x2_t const ez{vfmsq_f64(wz, t, dz)};
+            float64x2_t const distance{vfmaq_f64(vfmaq_f64(vmulq_f64(ex, ex), ey, ey), ez, ez)};
+
+            uint64x2_t const closer{vcltq_f64(distance, minDistance)};
+            minDistance = vbslq_f64(closer, distance, minDistance);
+            minId = vbslq_f64(closer, id, minId);
+            id = vaddq_f64(id, two);
+        }
+
+        double laneDistance[2];
+        double laneId[2];
+        vst1q_f64(laneDistance, minDistance);
+        vst1q_f64(laneId, minId);
+
+        for(int lane = 0; lane < 2; ++lane) {
+            int const laneSegment{static_cast<int>(laneId[lane])};
+            if(laneSegment >= 0 and (laneDistance[lane] < minSquaredDistance or
+                (laneDistance[lane] == minSquaredDistance and laneSegment < segmentId))) {
+                minSquaredDistance = laneDistance[lane];
+                segmentId = laneSegment;
+            }
+        }
+    }
+
+#endif
+
+    // Scalar fallback and remainder
+    for(; i < lastSegment; ++i) {
+        double const wx{px - startX_[i]};
+        double const wy{py - startY_[i]};
+        double const wz{pz - startZ_[i]};
+
+        double t{(wx * directionX_[i] + wy * directionY_[i] + wz * directionZ_[i]) * inverseSquaredLength_[i]};
+        t = std::min(std::max(t, 0.0), 1.0);
+
+        double const ex{wx - t * directionX_[i]};
+        double const ey{wy - t * directionY_[i]};
+        double const ez{wz - t * directionZ_[i]};
+        double const distance{ex * ex + ey * ey + ez * ez};
+
+        if(distance < minSquaredDistance) {
+            minSquaredDistance = distance;
+            segmentId = i;
+        }
+    }
+
+    // Only the winner needs its projection parameter.
+    double t{0};
+    double distance{0};
+    std::tie(t, distance) = Project(segmentId, worldF_position);
+
+    return std::make_tuple(segmentId, t, distance);
+}
+
+
+std::tuple<double, double> SegmentKernel::Project(int segmentId, Eigen::Vector3d const& worldF_position, double tMin, double tMax) const
+{
+    double const wx{worldF_position[0] - startX_[segmentId]};
+    double const wy{worldF_position[1] - startY_[segmentId]};
+    double const wz{worldF_position[2] - startZ_[segmentId]};
+
+    double t{(wx * directionX_[segmentId] + wy * directionY_[segmentId] + wz * directionZ_[segmentId])
+        * inverseSquaredLength_[segmentId]};
+    t = std::min(std::max(t, tMin), tMax);
+
+    double const ex{wx - t * directionX_[segmentId]};
+    double const ey{wy - t * directionY_[segmentId]};
+    double const ez{wz - t * directionZ_[segmentId]};
+
+    return std::make_tuple(t, std::sqrt(ex * ex + ey * ey + ez * ez));
+}
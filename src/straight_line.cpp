@@ -14,11 +14,14 @@ StraightLine::StraightLine(Eigen::Vector3d startPoint, Eigen::Vector3d endPoint,
             endParameter_m_ = 0;
             length_ = 0;
             curve_ = nullptr;
+            startPoint_ = startPoint;
+            endPoint_ = endPoint;
         }
         else {
 
             // Generate a straight line from startPoint to endPoint
             s1602(&startPoint[0], &endPoint[0], Order(), Dimension(), startParameter_s_, &endParameter_s_, &curve_, &statusFlag_);
+            BindKernel();
 
             // Pick parameters range of the curve.
             s1363(curve_, &startParameter_s_, &endParameter_s_, &statusFlag_);
@@ -38,4 +41,21 @@ StraightLine::StraightLine(Eigen::Vector3d startPoint, Eigen::Vector3d endPoint,
             endParameter_m_ = endParameter_s_ * (length_ / (endParameter_s_ - startParameter_s_));
 
         }
+
+        CacheEndpointData();
     }
+
+
+std::shared_ptr<Curve> StraightLine::Offset(double distance, double /*tolerance*/)
+{
+    Eigen::Vector3d normal{Eigen::Vector3d::UnitZ().cross(endPoint_ - startPoint_)};
+
+    if(length_ == 0 or normal.norm() == 0)
+        throw std::runtime_error("[StraightLine::Offset] The offset direction is not defined for a line orthogonal to the xy plane");
+
+    normal.normalize();
+
+    auto offsetLine = std::make_shared<StraightLine>(startPoint_ + distance * normal, endPoint_ + distance * normal, Dimension(), Order());
+    
+    return offsetLine;
+}
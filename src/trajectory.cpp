@@ -0,0 +1,204 @@
+#include "sisl_toolbox/trajectory.hpp"
+
+#include "sisl_toolbox/path.hpp"
+#include "sisl_toolbox/curve.hpp"
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <exception>
+
+
+Trajectory::Trajectory(std::shared_ptr<Path> path, double maxSpeed, double maxLateralAcceleration, 
+    double maxLongitudinalAcceleration, double step, double startSpeed, double endSpeed)
+    : path_{path}
+    , step_{step}
+    , timeStep_{0}
+{
+    if(path == nullptr or path->CurvesNumber() == 0)
+        throw std::runtime_error("[Trajectory::Trajectory] Input parameter error. Empty path");
+    if(maxSpeed <= 0 or maxLateralAcceleration <= 0 or maxLongitudinalAcceleration <= 0)
+        throw std::runtime_error("[Trajectory::Trajectory] Input parameter error. Limits must be positive");
+    if(step <= 0)
+        throw std::runtime_error("[Trajectory::Trajectory] Input parameter error. step must be positive");
+
+    const double startParameter_m{path->StartParameter()};
+    const double endParameter_m{path->EndParameter()};
+
+    // At least 3 samples: with a single interval both its ends could be at rest (null start and end speed)
+    if(endParameter_m - startParameter_m > 0)
+        step_ = std::min(step_, (endParameter_m - startParameter_m) / 2);
+    const int samples{std::max(3, static_cast<int>(std::ceil((endParameter_m - startParameter_m) / step_)) + 1)};
+
+    abscissae_.resize(samples);
+    speeds_.resize(samples);
+    times_.resize(samples);
+
+    /***************** Speed limits from the curvature *****************/
+
+    auto const& curves = path->Curves();
+    std::size_t curveId{0};
+    double curveStart_m{startParameter_m};
+    Eigen::Vector3d lastTangent{Eigen::Vector3d::Zero()}; // End tangent of the last curve with a non null length
+
+    for(int i = 0; i < samples; ++i) {
+
+        abscissae_[i] = std::min(startParameter_m + i * step_, endParameter_m);
+
+        double curvature{0};
+        while(curveId < curves.size() - 1 and abscissae_[i] > curveStart_m + curves[curveId]->Length()) {
+
+            // Sharp corner between two curves: equivalent curvature over one step. The null length curves (whose
+            // tangents are null) are skipped, the corner is taken between the curves around them.
+            auto const& curve = curves[curveId];
+            auto const& nextCurve = curves[curveId + 1];
+            if(curve->Length() > 0)
+                lastTangent = curve->EndTangent();
+            if(nextCurve->Length() > 0 and lastTangent.norm() > 0) {
+                double cosAngle{std::max(-1.0, std::min(1.0, lastTangent.dot(nextCurve->StartTangent())))};
+                curvature = std::max(curvature, std::acos(cosAngle) / step_);
+            }
+
+            curveStart_m += curve->Length();
+            ++curveId;
+        }
+
+        auto const& curve = curves[curveId];
+        double abscissaCurve_m{std::min(curve->StartParameter_m() + (abscissae_[i] - curveStart_m), curve->EndParameter_m())};
+        try {
+            curvature = std::max(curvature, std::abs(curve->Curvature(abscissaCurve_m)));
+        } catch (std::runtime_error const& exception) {
+            throw std::runtime_error(std::string("[Trajectory::Trajectory] -> ") + exception.what());
+        }
+
+        speeds_[i] = curvature > 0 ? std::min(maxSpeed, std::sqrt(maxLateralAcceleration / curvature)) : maxSpeed;
+    }
+
+    speeds_.front() = std::min(speeds_.front(), startSpeed);
+    speeds_.back() = std::min(speeds_.back(), endSpeed);
+
+    /***************** Forward pass (acceleration) *****************/
+
+    for(int i = 1; i < samples; ++i) {
+        double ds{abscissae_[i] - abscissae_[i - 1]};
+        speeds_[i] = std::min(speeds_[i], std::sqrt(speeds_[i - 1] * speeds_[i - 1] + 2 * maxLongitudinalAcceleration * ds));
+    }
+
+    /***************** Backward pass (deceleration) *****************/
+
+    for(int i = samples - 2; i >= 0; --i) {
+        double ds{abscissae_[i + 1] - abscissae_[i]};
+        speeds_[i] = std::min(speeds_[i], std::sqrt(speeds_[i + 1] * speeds_[i + 1] + 2 * maxLongitudinalAcceleration * ds));
+    }
+
+    /***************** Time stamps (constant acceleration on each interval) *****************/
+
+    times_.front() = 0;
+    for(int i = 1; i < samples; ++i) {
+        double ds{abscissae_[i] - abscissae_[i - 1]};
+        double meanSpeed{0.5 * (speeds_[i] + speeds_[i - 1])};
+        if(ds > 0 and meanSpeed <= 0)
+            throw std::runtime_error("[Trajectory::Trajectory] Null speed on a path interval");
+        times_[i] = times_[i - 1] + (ds > 0 ? ds / meanSpeed : 0);
+    }
+
+    /***************** Uniform time grid for the O(1) lookup *****************/
+
+    const std::size_t cells{static_cast<std::size_t>(samples)};
+    timeStep_ = times_.back() / cells;
+    timeIndex_.resize(cells + 1);
+
+    std::size_t interval{0};
+    for(std::size_t k = 0; k <= cells; ++k) {
+        double cellStart{k * timeStep_};
+        while(interval < static_cast<std::size_t>(samples) - 2 and times_[interval + 1] <= cellStart)
+            ++interval;
+        timeIndex_[k] = interval;
+    }
+}
+
+
+std::size_t Trajectory::IntervalAt(double time) const
+{
+    if(timeStep_ <= 0)
+        return 0;
+
+    std::size_t cell{std::min(static_cast<std::size_t>(time / timeStep_), timeIndex_.size() - 1)};
+    std::size_t interval{timeIndex_[cell]};
+
+    while(interval < times_.size() - 2 and times_[interval + 1] < time)
+        ++interval;
+
+    return interval;
+}
+
+
+double Trajectory::AbscissaAt(double time) const
+{
+    time = std::max(0.0, std::min(time, times_.back()));
+    std::size_t i{IntervalAt(time)};
+
+    double ds{abscissae_[i + 1] - abscissae_[i]};
+    if(ds <= 0)
+        return abscissae_[i];
+
+    double acceleration{(speeds_[i + 1] * speeds_[i + 1] - speeds_[i] * speeds_[i]) / (2 * ds)};
+    double tau{time - times_[i]};
+
+    return std::min(abscissae_[i] + speeds_[i] * tau + 0.5 * acceleration * tau * tau, abscissae_[i + 1]);
+}
+
+
+double Trajectory::SpeedAt(double time) const
+{
+    time = std::max(0.0, std::min(time, times_.back()));
+    std::size_t i{IntervalAt(time)};
+
+    double ds{abscissae_[i + 1] - abscissae_[i]};
+    if(ds <= 0)
+        return speeds_[i];
+
+    double acceleration{(speeds_[i + 1] * speeds_[i + 1] - speeds_[i] * speeds_[i]) / (2 * ds)};
+
+    return speeds_[i] + acceleration * (time - times_[i]);
+}
+
+
+double Trajectory::AccelerationAt(double time) const
+{
+    time = std::max(0.0, std::min(time, times_.back()));
+    std::size_t i{IntervalAt(time)};
+
+    double ds{abscissae_[i + 1] - abscissae_[i]};
+    if(ds <= 0)
+        return 0;
+
+    return (speeds_[i + 1] * speeds_[i + 1] - speeds_[i] * speeds_[i]) / (2 * ds);
+}
+
+
+double Trajectory::SpeedAtAbscissa(double abscissa_m) const
+{
+    abscissa_m = std::max(abscissae_.front(), std::min(abscissa_m, abscissae_.back()));
+
+    std::size_t i{std::min(static_cast<std::size_t>((abscissa_m - abscissae_.front()) / step_), abscissae_.size() - 2)};
+
+    double ds{abscissae_[i + 1] - abscissae_[i]};
+    if(ds <= 0)
+        return speeds_[i];
+
+    // v^2 is linear in s with constant acceleration.
+    double ratio{std::min((abscissa_m - abscissae_[i]) / ds, 1.0)};
+
+    return std::sqrt(speeds_[i] * speeds_[i] + ratio * (speeds_[i + 1] * speeds_[i + 1] - speeds_[i] * speeds_[i]));
+}
+
+
+Eigen::Vector3d Trajectory::At(double time) const
+{
+    try {
+        return path_->At(AbscissaAt(time));
+    } catch (std::runtime_error const& exception) {
+        throw std::runtime_error(std::string("[Trajectory::At] -> ") + exception.what());
+    }
+}
@@ -0,0 +1,94 @@
+#include "test/test_path.hpp"
+#include <vector>
+
+#include <iomanip>
+
+
+int main() {
+
+    /***************** Path creation *****************/
+    // unsync the I/O of C and C++.
+    std::ios_base::sync_with_stdio(false);
+
+    std::vector<Eigen::Vector3d> polygonVerteces {
+        Eigen::Vector3d {-78, 44, 0}, Eigen::Vector3d {-47, 99, 0}, Eigen::Vector3d {46, 80, 0},
+        Eigen::Vector3d {79, -43, 0}, Eigen::Vector3d {-23, -99, 0}, Eigen::Vector3d{-110, -71, 0} };
+
+
+    double angle{150.0};
+    double offsetPath{30.0};
+    double transitionLength{10.0};
+
+    std::shared_ptr<Path> serpentine;
+
+    try {
+        auto start = std::chrono::high_resolution_clock::now();
+        serpentine = PathFactory::NewSerpentine(angle, RIGHT, offsetPath, polygonVerteces, transitionLength);
+        auto end = std::chrono::high_resolution_clock::now();
+
+        std::cout << *serpentine << std::endl;
+
+        // Calculating total time taken by the program.
+        double time_taken = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+        time_taken *= 1e-9;
+        std::cout << "Time taken to build the Path object : " << std::fixed << std::setprecision(9) << time_taken  << " sec" << std::endl;
+        std::cout << std::fixed << std::setprecision(3);
+
+        PersistenceManager::SaveObj(serpentine->Sampling(1500), "/home/antonio/sisl_toolbox/script/path.txt");
+
+        std::cout << std::endl << serpentine->Name() << " is composed by: " << std::endl;
+        for(int i = 0; i < serpentine->CurvesNumber(); ++i) {
+            std::cout << i << ". " << *serpentine->Curves()[i] << std::endl;
+        }
+
+
+        /***************** Curvature continuity *****************/
+
+        double maxJump{0};
+        for(int i = 0; i < serpentine->CurvesNumber() - 1; ++i) {
+            auto const& curve = serpentine->Curves()[i];
+            auto const& nextCurve = serpentine->Curves()[i + 1];
+            double jump = std::abs(curve->Curvature(curve->EndParameter_m()) - nextCurve->Curvature(nextCurve->StartParameter_m()));
+            maxJump = std::max(maxJump, jump);
+        }
+        std::cout << std::endl << "Maximum curvature jump between consecutive curves: " << maxJump << std::endl;
+
+
+        /***************** Clothoid evaluation *****************/
+
+        auto clothoid = std::make_shared<Clothoid>(Eigen::Vector3d{0, 0, 0}, 0, 0, 1.0 / 20.0, transitionLength);
+
+        start = std::chrono::high_resolution_clock::now();
+        Eigen::Vector3d point{};
+        for(int i = 0; i < 100000; ++i) {
+            point = clothoid->At(transitionLength * (i % 1000) / 1000.0);
+        }
+        end = std::chrono::high_resolution_clock::now();
+        time_taken = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / 100000.0;
+        std::cout << "Time taken by Clothoid::At : " << time_taken << " ns" << std::endl;
+
+        auto endPoint = clothoid->At(transitionLength);
+        std::cout << "Clothoid end point: [" << endPoint[0] << ", " << endPoint[1] << ", " << endPoint[2] << "]"
+            << " | curvature: " << clothoid->Curvature(transitionLength) << std::endl;
+
+        Eigen::Vector3d findNearThis{5, 2, 0};
+        double abscissaClosest{0};
+        double distance{0};
+        std::tie(abscissaClosest, distance) = clothoid->FindClosestPoint(findNearThis);
+        std::cout << "Closest point abscissa: " << abscissaClosest << " | distance: " << distance << std::endl;
+
+        /***************** Cached end point data *****************/
+
+        auto boxMin = clothoid->BoxMin();
+        auto boxMax = clothoid->BoxMax();
+        auto endTangent = clothoid->EndTangent();
+        std::cout << "Clothoid bounding box: [" << boxMin[0] << ", " << boxMin[1] << "] - [" << boxMax[0] << ", " << boxMax[1] << "]"
+            << " | end tangent: [" << endTangent[0] << ", " << endTangent[1] << "]"
+            << " | end curvature: " << clothoid->EndPointCurvature() << std::endl;
+    }
+    catch(std::runtime_error const& exception) {
+        std::cout << "Received exception from --> " << exception.what() << std::endl;
+    }
+
+    return 0;
+}
@@ -1,5 +1,6 @@
 #include "test/test_path.hpp"
 #include "sisl_toolbox/generic_curve.hpp"
+#include "sisl_toolbox/curve_approximation.hpp"
 #include <vector>
 
 #include <iomanip>
@@ -48,6 +49,92 @@ int main() {
 
         PersistenceManager::SaveObj(path->Sampling(20), "/home/marco/pasqua_ros2_devel/src/Virtual_Frame_Controller/sisl_toolbox/script/path.txt");
 
+
+        /***************** Fitting a recorded track *****************/
+
+        std::vector<Eigen::Vector3d> track;
+        for(int i = 0; i < 100000; ++i) {
+            double t{i * 1e-3};
+            track.push_back(Eigen::Vector3d{3 * t, 20 * sin(t / 3), 0.0});
+        }
+
+        auto start = std::chrono::high_resolution_clock::now();
+        auto fittedCurve = std::make_shared<GenericCurve>(track, 1e-3);
+        auto end = std::chrono::high_resolution_clock::now();
+
+        std::cout << std::endl << "Fitted " << track.size() << " samples with " << fittedCurve->Points().size() 
+            << " control points, maximum error: " << fittedCurve->FittingError() << std::endl;
+        std::cout << "Time taken by the fitting : " 
+            << std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() * 1e-9 << " sec" << std::endl;
+
+
+        /***************** Batch evaluation *****************/
+
+        std::vector<double> abscissae(100000);
+        for(std::size_t i = 0; i < abscissae.size(); ++i) {
+            abscissae[i] = fittedCurve->StartParameter_m()
+                + (fittedCurve->EndParameter_m() - fittedCurve->StartParameter_m()) * i / (abscissae.size() - 1);
+        }
+
+        start = std::chrono::high_resolution_clock::now();
+        auto batchPoints = fittedCurve->BatchAt(abscissae);
+        end = std::chrono::high_resolution_clock::now();
+        double batchTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() * 1e-9;
+
+        double maxDifference{0};
+        start = std::chrono::high_resolution_clock::now();
+        for(std::size_t i = 0; i < abscissae.size(); ++i) {
+            maxDifference = std::max(maxDifference, (fittedCurve->At(abscissae[i]) - batchPoints[i]).norm());
+        }
+        end = std::chrono::high_resolution_clock::now();
+        double scalarTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() * 1e-9;
+
+        std::cout << "Batch evaluation of " << abscissae.size() << " points: " << batchTime << " sec (scalar loop: " << scalarTime
+            << " sec), maximum difference: " << maxDifference << std::endl;
+
+
+        /***************** Derivatives *****************/
+
+        double middle{0.5 * (genericCurve->StartParameter_m() + genericCurve->EndParameter_m())};
+        auto derivates = genericCurve->Derivate(3, middle);
+        std::cout << std::endl << "Derivatives at abscissa " << middle << ":" << std::endl;
+        for(std::size_t i = 0; i < derivates.size(); ++i) {
+            std::cout << i + 1 << ". [" << derivates[i][0] << ", " << derivates[i][1] << ", " << derivates[i][2] << "]" << std::endl;
+        }
+        std::cout << "Curvature: " << genericCurve->Curvature(middle) << std::endl;
+
+
+        /***************** Polynomial approximation *****************/
+
+        std::vector<Eigen::Vector3d> exactPoints(abscissae.size());
+        start = std::chrono::high_resolution_clock::now();
+        for(std::size_t i = 0; i < abscissae.size(); ++i) {
+            exactPoints[i] = fittedCurve->At(abscissae[i]);
+        }
+        end = std::chrono::high_resolution_clock::now();
+        double exactTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() * 1e-9;
+
+        fittedCurve->EnableApproximation(1e-6);
+        auto approximation = fittedCurve->Approximation(); // Built here, at the first query
+        if(not approximation->Converged()) {
+            std::cout << "Approximation not converged: estimated error " << approximation->MaxError() << " above the tolerance " 
+                << approximation->Tolerance() << std::endl;
+        }
+
+        maxDifference = 0;
+        start = std::chrono::high_resolution_clock::now();
+        for(std::size_t i = 0; i < abscissae.size(); ++i) {
+            maxDifference = std::max(maxDifference, (fittedCurve->At(abscissae[i]) - exactPoints[i]).norm());
+        }
+        end = std::chrono::high_resolution_clock::now();
+        double approximationTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() * 1e-9;
+
+        std::cout << std::endl << "Approximation with " << approximation->PiecesNumber() << " pieces: " << approximationTime 
+            << " sec (exact: " << exactTime << " sec), maximum difference: " << maxDifference << std::endl;
+        std::cout << "Arc length: " << approximation->TotalArcLength() << " (curve length " << fittedCurve->Length() 
+            << "), middle of the arc length at abscissa " << approximation->MeterAbs(0.5 * approximation->TotalArcLength()) 
+            << std::endl;
+
     }
     catch(std::runtime_error const& exception) {
         std::cout << "Received exception from --> " << exception.what() << std::endl;
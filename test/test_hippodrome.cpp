@@ -159,6 +159,18 @@ int main() {
 
         auto pathSection = hippodrome->ExtractSection(5, 10);
         PersistenceManager::SaveObj(pathSection->Sampling(100), "/home/antonio/sisl_toolbox/script/pathSection.txt");
+
+
+        /***************** Path View Problem  *****************/
+
+        PathView pathView(hippodrome, 5, 10);
+        Eigen::Vector3d viewPoint{1, 1, 0};
+        double viewAbscissa_m{0};
+        auto viewClosestPoint = pathView.FindClosestPoint(viewPoint, viewAbscissa_m);
+        std::cout << std::endl << "View [" << pathView.StartAbscissa() << ", " << pathView.EndAbscissa() << "] closest point: " 
+            << viewClosestPoint.transpose() << " at view abscissa " << viewAbscissa_m << ", curvature " 
+            << pathView.Curvature(viewAbscissa_m) << std::endl;
+        PersistenceManager::SaveObj(pathView.Sampling(100), "/home/antonio/sisl_toolbox/script/pathView.txt");
     
     } catch(std::runtime_error const& exception) {
         std::cout << "Received exception from --> " << exception.what() << std::endl;
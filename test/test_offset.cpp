@@ -0,0 +1,65 @@
+#include "test/test_path.hpp"
+#include <vector>
+
+#include <iomanip>
+
+
+int main() {
+
+    /***************** Path creation *****************/
+    // unsync the I/O of C and C++.
+    std::ios_base::sync_with_stdio(false);
+
+    std::shared_ptr<Path> polygon;
+
+    try {
+        polygon = PathFactory::NewPolygon(std::vector<Eigen::Vector3d>{Eigen::Vector3d{13, 27, 0}, Eigen::Vector3d{52, 40, 0},
+                                                                        Eigen::Vector3d{-2, 52, 0}, Eigen::Vector3d{-30, 35, 0},
+                                                                        Eigen::Vector3d{-12, 8, 0}});
+
+        std::cout << *polygon << std::endl;
+        std::cout << std::fixed << std::setprecision(3);
+
+        PersistenceManager::SaveObj(polygon->Sampling(500), "/home/antonio/sisl_toolbox/script/path.txt");
+
+
+        /***************** Offset paths *****************/
+
+        std::vector<double> distances{-4.0, 4.0};
+
+        auto start = std::chrono::high_resolution_clock::now();
+        auto offsetPaths = polygon->Offset(distances);
+        auto end = std::chrono::high_resolution_clock::now();
+
+        double time_taken = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+        time_taken *= 1e-9;
+        std::cout << "Time taken to build the offset paths : " << std::fixed << std::setprecision(9) << time_taken  << " sec" << std::endl;
+        std::cout << std::fixed << std::setprecision(3);
+
+        for(std::size_t i = 0; i < offsetPaths.size(); ++i) {
+
+            auto const& offsetPath = offsetPaths[i];
+            std::cout << std::endl << "Distance " << distances[i] << " -> " << *offsetPath << std::endl;
+            for(int j = 0; j < offsetPath->CurvesNumber(); ++j) {
+                std::cout << j << ". " << *offsetPath->Curves()[j] << std::endl;
+            }
+
+            // The distance from the original path must be |distance| everywhere.
+            double maxError{0};
+            for(auto const& point: *offsetPath->Sampling(500)) {
+                Eigen::Vector3d samplePoint{point};
+                auto closestPoint = polygon->FindClosestPoint(samplePoint);
+                maxError = std::max(maxError, std::abs((closestPoint - point).norm() - std::abs(distances[i])));
+            }
+            std::cout << "Maximum distance error: " << maxError << std::endl;
+
+            PersistenceManager::SaveObj(offsetPath->Sampling(500),
+                "/home/antonio/sisl_toolbox/script/offsetPath" + std::to_string(i) + ".txt");
+        }
+    }
+    catch(std::runtime_error const& exception) {
+        std::cout << "Received exception from --> " << exception.what() << std::endl;
+    }
+
+    return 0;
+}
@@ -55,6 +55,16 @@ int main() {
             << " -> , abscissa path: " << absPath_m << std::endl;
 
 
+        /***************** Path editing *****************/
+
+        auto detour = std::make_shared<StraightLine>(polygon->Curves()[0]->StartPoint(), polygon->Curves()[0]->EndPoint());
+        polygon->Insert(1, detour);
+        polygon->Erase(0);
+        polygon->Replace(0, polygon->Curves()[0]);
+        std::tie(abscissaCurve_m, curveId) = polygon->PathAbsToCurveAbs(polygon->Length());
+        std::cout << std::endl << "After editing -> " << *polygon << ", last curveId: " << curveId << std::endl;
+
+
         /***************** Intersection Problem  *****************/
 
         /*
@@ -78,6 +88,73 @@ int main() {
         outputIntersection.close();
         */
 
+        /***************** Rotation minimising frames  *****************/
+
+        FrameTable frameTable(polygon, 0.05);
+        Eigen::Vector3d tangent{}, normal{}, binormal{};
+
+        start = std::chrono::high_resolution_clock::now();
+        for(int i = 0; i < 100000; ++i) {
+            frameTable.EvalTangentFrame(polygon->Length() * (i % 1000) / 1000.0, tangent, normal, binormal);
+        }
+        end = std::chrono::high_resolution_clock::now();
+        std::cout << std::endl << "Time taken by FrameTable::EvalTangentFrame : " 
+            << std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / 100000.0 << " ns" << std::endl;
+
+        frameTable.EvalTangentFrame(absPath_m, tangent, normal, binormal);
+        std::cout << "Frame at abscissa " << absPath_m << " -> tangent: [" << tangent[0] << ", " << tangent[1] << ", " << tangent[2] 
+            << "], normal: [" << normal[0] << ", " << normal[1] << ", " << normal[2] << "]" << std::endl;
+
+
+        /***************** Rounded corners  *****************/
+
+        std::vector<Eigen::Vector3d> polygonVerteces{Eigen::Vector3d{13, 27, 0}, Eigen::Vector3d{52, 40, 0}, 
+                                                     Eigen::Vector3d{-2, 52, 0}, Eigen::Vector3d{-30, 35, 0},
+                                                     Eigen::Vector3d{-12, 8, 0}};
+
+        start = std::chrono::high_resolution_clock::now();
+        auto roundedPolygon = PathFactory::NewRoundedPolygon(polygonVerteces, 5.0, 2.0);
+        end = std::chrono::high_resolution_clock::now();
+
+        std::cout << std::endl << *roundedPolygon << std::endl;
+        std::cout << "Time taken to build the rounded polygon : " 
+            << std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() * 1e-9 << " sec" << std::endl;
+        PersistenceManager::SaveObj(roundedPolygon->Sampling(500), "/home/antonio/sisl_toolbox/script/roundedPolygon.txt");
+
+
+        /***************** Profile lookup table  *****************/
+
+        PathProfile profile(roundedPolygon, 0.5);
+        Eigen::Vector3d profilePosition{};
+        double profileHeading{0};
+        double profileCurvature{0};
+
+        start = std::chrono::high_resolution_clock::now();
+        for(int i = 0; i < 100000; ++i) {
+            profile.Eval(roundedPolygon->Length() * (i % 1000) / 1000.0, profilePosition, profileHeading, profileCurvature);
+        }
+        end = std::chrono::high_resolution_clock::now();
+        std::cout << std::endl << "Profile table with " << profile.IntervalsNumber() << " intervals, time taken by PathProfile::Eval : " 
+            << std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / 100000.0 << " ns" << std::endl;
+
+        double profileAbscissa{0.5 * roundedPolygon->Length()};
+        profile.Eval(profileAbscissa, profilePosition, profileHeading, profileCurvature);
+        std::cout << "Profile at abscissa " << profileAbscissa << " -> heading: " << profileHeading << ", curvature: " 
+            << profileCurvature << " (path curvature: " << roundedPolygon->Curvature(profileAbscissa) << ")" << std::endl;
+
+
+        /***************** Simplification  *****************/
+
+        std::vector<Eigen::Vector3d> densePoints;
+        for(int i = 0; i <= 1000; ++i) {
+            densePoints.push_back(Eigen::Vector3d{i < 500 ? 0.1 * i : 50.0, i < 500 ? 0.0 : 0.1 * (i - 500), 0});
+        }
+        auto denseChain = PathFactory::NewPolygonalChain(densePoints);
+        auto simplifiedChain = denseChain->Simplify(0.001);
+        std::cout << std::endl << "Simplified " << denseChain->CurvesNumber() << " curves into " 
+            << simplifiedChain->CurvesNumber() << " curves" << std::endl;
+
+
         /***************** Closest Point Problem  *****************/
 
         Eigen::Vector3d findNearThis{0.3, 0, 0};
@@ -98,6 +175,76 @@ int main() {
         outputFile.close();
 
 
+        /***************** Closest Point on a long polygonal chain  *****************/
+
+        std::vector<Eigen::Vector3d> longChainPoints;
+        for(int i = 0; i <= 100000; ++i) {
+            longChainPoints.push_back(Eigen::Vector3d{0.5 * i, 3.0 * std::sin(0.01 * i), 0});
+        }
+        auto longChain = PathFactory::NewPolygonalChain(longChainPoints);
+
+        Eigen::Vector3d findNearLong{12345.6, 10, 0};
+        longChain->FindClosestPoint(findNearLong); // The segment kernel is built at the first query
+
+        auto startLong = std::chrono::high_resolution_clock::now();
+        Eigen::Vector3d closestLong{};
+        for(int i = 0; i < 100; ++i) {
+            closestLong = longChain->FindClosestPoint(findNearLong);
+        }
+        auto endLong = std::chrono::high_resolution_clock::now();
+        double timeLong = std::chrono::duration_cast<std::chrono::nanoseconds>(endLong - startLong).count() * 1e-3 / 100;
+
+        std::cout << std::endl << "Closest point on a chain of " << longChain->CurvesNumber() << " lines: [" << closestLong[0]
+            << ", " << closestLong[1] << ", " << closestLong[2] << "] in " << timeLong << " us" << std::endl;
+        std::cout << "Abscissa on the interval [20000, 30000]: "
+            << longChain->FindAbscissaClosestPointOnInterval(findNearLong, 20000, 30000) << std::endl;
+
+
+        /***************** Receding horizon on a long polygonal chain  *****************/
+
+        PathHorizon horizon(longChain, 200, 50);
+        auto startHorizon = std::chrono::high_resolution_clock::now();
+        for(int i = 0; i < 1000; ++i) {
+            Eigen::Vector3d vehicle{10.0 * i, 3.0 * std::sin(0.02 * i) + 0.5, 0};
+            horizon.Track(vehicle);
+        }
+        auto endHorizon = std::chrono::high_resolution_clock::now();
+        double timeHorizon = std::chrono::duration_cast<std::chrono::nanoseconds>(endHorizon - startHorizon).count() * 1e-3 / 1000;
+
+        std::cout << "Receding horizon: abscissa " << horizon.Abscissa() << ", " << horizon.LocalPath()->CurvesNumber() 
+            << " curves loaded, " << timeHorizon << " us per tracking step" << std::endl;
+
+
+        /***************** Planar path  *****************/
+
+        std::vector<Eigen::Vector2d> planarVerteces;
+        for(auto const& vertex: polygonVerteces) {
+            planarVerteces.push_back(vertex.head<2>());
+        }
+        auto planarPolygon = PathFactory::NewPlanarRoundedPolygon(planarVerteces, 5.0, 2.0);
+        std::cout << std::endl << *planarPolygon << std::endl;
+
+        PlanarPath convertedPolygon(*roundedPolygon);
+        std::cout << "Converted from Path: " << convertedPolygon << ", length difference: " 
+            << std::abs(convertedPolygon.Length() - roundedPolygon->Length()) << std::endl;
+
+        Eigen::Vector2d findNearPlanar{10, 30};
+        Eigen::Vector3d findNearSpatial{10, 30, 0};
+        start = std::chrono::high_resolution_clock::now();
+        double planarAbscissa = planarPolygon->FindAbscissaClosestPoint(findNearPlanar);
+        end = std::chrono::high_resolution_clock::now();
+        std::cout << "Planar closest point abscissa: " << planarAbscissa << " (Path: " 
+            << roundedPolygon->FindAbscissaClosestPoint(findNearSpatial) << ") in " 
+            << std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() * 1e-3 << " us" << std::endl;
+
+        auto planarDubins = PathFactory::NewPlanarDubinsPath(Eigen::Vector2d{-40, 0}, 0, Eigen::Vector2d{60, 60}, M_PI / 2, 8.0);
+        auto planarIntersections = planarPolygon->Intersection(*planarDubins);
+        std::cout << *planarDubins << " intersects the rounded polygon in " << planarIntersections.size() << " points" << std::endl;
+        for(auto const& point: planarIntersections) {
+            std::cout << "[" << point[0] << ", " << point[1] << "]" << std::endl;
+        }
+
+
         /***************** Move Point Problem  *****************/
 
         /*
@@ -161,6 +161,49 @@ int main() {
         std::cout << "Second order derivative at 300m: [" << derivatives[1][0] << ", " << derivatives[1][1] << ", " << derivatives[1][2] << "]" << std::endl;
 
 
+        /***************** Velocity profile *****************/
+
+        double maxSpeed{2.0};
+        double maxLateralAcceleration{0.2};
+        double maxLongitudinalAcceleration{0.1};
+
+        start = std::chrono::high_resolution_clock::now();
+        Trajectory trajectory(raceTrack, maxSpeed, maxLateralAcceleration, maxLongitudinalAcceleration, 0.5);
+        end = std::chrono::high_resolution_clock::now();
+
+        std::cout << std::endl << trajectory << std::endl;
+        std::cout << "Time taken to build the velocity profile : " 
+            << std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() * 1e-9 << " sec" << std::endl;
+
+        std::ofstream outputFile3;
+        outputFile3.open ("/home/antonio/sisl_toolbox/script/velocityProfile.txt");
+        for(double time = 0; time <= trajectory.Duration(); time += 1.0) {
+            outputFile3 << time << " " << trajectory.AbscissaAt(time) << " " << trajectory.SpeedAt(time) << "\n";
+        }
+        outputFile3.close();
+
+
+        /***************** Dubins connector *****************/
+
+        Eigen::Vector3d transitStart{raceTrack->LastCurve()->EndPoint()};
+        Eigen::Vector3d transitEnd{-150, 120, 0};
+        double connectorRadius{10.0};
+
+        start = std::chrono::high_resolution_clock::now();
+        double connectorLength{0};
+        for(int i = 0; i < 10000; ++i) {
+            connectorLength = PathFactory::DubinsLength(transitStart, 0.0, transitEnd, 0.001 * i, connectorRadius);
+        }
+        end = std::chrono::high_resolution_clock::now();
+        std::cout << std::endl << "Time taken by PathFactory::DubinsLength : " 
+            << std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / 10000.0 << " ns" << std::endl;
+        std::cout << "Last connector length: " << connectorLength << std::endl;
+
+        auto connector = PathFactory::NewDubinsPath(transitStart, 0.0, transitEnd, M_PI_2, connectorRadius);
+        std::cout << *connector << std::endl;
+        PersistenceManager::SaveObj(connector->Sampling(200), "/home/antonio/sisl_toolbox/script/connector.txt");
+
+
     }
     catch(std::runtime_error const& exception) {
         std::cout << "Received exception from --> " << exception.what() << std::endl;
@@ -35,6 +35,47 @@ int main() {
 
         PersistenceManager::SaveObj(serpentine->Sampling(1500), "/home/antonio/sisl_toolbox/script/path.txt");
 
+        start = std::chrono::high_resolution_clock::now();
+        auto simplifiedSampling = PolylineSimplifier::SimplifiedSampling(serpentine, 1000000, 0.01);
+        end = std::chrono::high_resolution_clock::now();
+        std::cout << "Simplified sampling: " << simplifiedSampling->size() << " points out of 1000000 in " 
+            << std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() * 1e-9 << " sec" << std::endl;
+        PersistenceManager::SaveObj(simplifiedSampling, "/home/antonio/sisl_toolbox/script/simplifiedPath.txt");
+
+
+        /***************** Geodetic polygon *****************/
+
+        // Survey polygon a few km from the origin, at altitude 0: in the ENU frame its vertices are below the tangent plane
+        // (Earth curvature), the factory projects them on it.
+        GeodeticFrame frame(Eigen::Vector3d{44.4056, 8.9463, 0});
+        std::vector<Eigen::Vector3d> geodeticVerteces;
+        for(auto const& vertex: polygonVerteces) {
+            geodeticVerteces.push_back(frame.ToGeodetic(Eigen::Vector3d{vertex[0] + 3000, vertex[1] + 2000, 0}));
+            geodeticVerteces.back()[2] = 0;
+        }
+        std::cout << "ENU height of the first geodetic vertex: " << frame.ToENU(geodeticVerteces.front())[2] << std::endl;
+
+        auto geodeticSerpentine = PathFactory::NewSerpentine(angle, RIGHT, offsetPath, frame, geodeticVerteces);
+        std::cout << "Serpentine from geodetic polygon -> " << *geodeticSerpentine << std::endl;
+
+        start = std::chrono::high_resolution_clock::now();
+        auto geodeticSampling = frame.ToGeodetic(geodeticSerpentine->Sampling(1000000));
+        end = std::chrono::high_resolution_clock::now();
+        std::cout << "Time taken to convert " << geodeticSampling->size() << " samples to geodetic coordinates : " 
+            << std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() * 1e-9 << " sec" << std::endl;
+
+        // Large offsets (beyond the small angle polynomials, also on the far side of the Earth) in the batch conversion
+        GeodeticFrame farFrame(Eigen::Vector3d{45, 0, 0});
+        std::vector<Eigen::Vector3d> farPoints{farFrame.ToENU(Eigen::Vector3d{45, 52.33, 0}), 
+            farFrame.ToENU(Eigen::Vector3d{-30, 170, 100}), farFrame.ToENU(Eigen::Vector3d{45.1, 0.1, 0})};
+        auto farGeodetic = farFrame.ToGeodetic(farPoints);
+        double maxFarError{0};
+        for(std::size_t i = 0; i < farPoints.size(); ++i) {
+            maxFarError = std::max(maxFarError, (farGeodetic[i] - farFrame.ToGeodetic(farPoints[i])).norm());
+        }
+        std::cout << "Batch vs single conversion of far points, max difference: " << maxFarError 
+            << ", longitude at 52.33 deg east: " << farGeodetic[0][1] << std::endl;
+
         double abscissaCurve_m{0};
         int curveId{0};
 
@@ -154,6 +195,32 @@ int main() {
         std::cout << "Second order derivative at 300m: [" << derivatives[1][0] << ", " << derivatives[1][1] << ", " << derivatives[1][2] << "]" << std::endl;
 
 
+        /***************** Mission composition *****************/
+
+        auto transit = std::make_shared<Path>();
+        transit->AddCurveBack(std::make_shared<StraightLine>(serpentine->LastCurve()->EndPoint(), Eigen::Vector3d{0, 0, 0}));
+
+        CompositePath mission;
+        mission.Append(serpentine);
+        mission.Append(transit);
+        std::cout << "Mission of " << mission.PartsNumber() << " paths, length " << mission.Length() << ", end point: [" 
+            << mission.At(mission.Length()).transpose() << "], flattened in " << mission.Flatten()->CurvesNumber() << " curves" 
+            << std::endl;
+
+
+        /***************** Incremental coverage re-planning *****************/
+
+        CoveragePlanner planner(angle, RIGHT, offsetPath, polygonVerteces);
+        std::cout << "Coverage path of " << planner.LegsNumber() << " legs, length " << planner.GetPath()->Length() << std::endl;
+
+        start = std::chrono::high_resolution_clock::now();
+        planner.MoveVertex(2, Eigen::Vector3d{60, 95, 0});
+        end = std::chrono::high_resolution_clock::now();
+        std::cout << "Vertex moved: " << planner.UpdatedLines() << " sweep lines updated, " << planner.RebuiltCurves() 
+            << " curves rebuilt, new length " << planner.GetPath()->Length() << " in " 
+            << std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() * 1e-9 << " sec" << std::endl;
+
+
     }
     catch(std::runtime_error const& exception) {
         std::cout << "Received exception from --> " << exception.what() << std::endl;